@@ -214,6 +214,19 @@ class Gear::Renderer final
 public:
     inline Renderer()
     {
+        using namespace dst::sys;
+        toggleAnimation = inputMap.add_action();
+        inputMap.bind_action(toggleAnimation, { Keyboard::Key::A });
+        toggleWireFrame = inputMap.add_action();
+        inputMap.bind_action(toggleWireFrame, { Keyboard::Key::W });
+        rotate = inputMap.add_action();
+        inputMap.bind_action(rotate, { }, { Mouse::Button::Left });
+        pan = inputMap.add_action();
+        inputMap.bind_action(pan, { }, { Mouse::Button::Middle });
+        inputMap.bind_action(pan, { }, { Mouse::Button::Right });
+        zoom = inputMap.add_axis();
+        inputMap.bind_axis(zoom, InputMap::Analog::MouseScroll, 1);
+
         gears[0].position = { -3.f, -2.f, 0.0f };
         gears[0].color = { 0.8f, 0.1f, 0.0f, 1.0f };
         gears[0].rotation = 0;
@@ -233,21 +246,21 @@ public:
     inline void update(float deltaTime, const dst::sys::Input& input)
     {
         using namespace dst::sys;
-        if (input.keyboard.pressed(Keyboard::Key::A)) {
+        inputMap.update(input);
+        if (inputMap.pressed(toggleAnimation)) {
             animation = !animation;
         }
-        if (input.keyboard.pressed(Keyboard::Key::W)) {
+        if (inputMap.pressed(toggleWireFrame)) {
             wireFrame = !wireFrame;
         }
-        if (input.mouse.down(Mouse::Button::Left)) {
-            auto look = input.mouse.position_delta() * lookSensitivity * deltaTime;
+        if (inputMap.down(rotate)) {
+            auto look = glm::vec2 { input.mouse.motion_delta() } * lookSensitivity;
             auto rotationX = glm::angleAxis(look.y, glm::vec3 { 1, 0, 0 });
             auto rotationY = glm::angleAxis(look.x, glm::vec3 { 0, 1, 0 });
             worldRotation = glm::normalize(rotationX * rotationY * worldRotation);
         }
-        cameraPosition.z -= input.mouse.scroll_delta() * scrollSensitivity * deltaTime;
-        if (input.mouse.down(Mouse::Button::Middle) ||
-            input.mouse.down(Mouse::Button::Right)) {
+        cameraPosition.z -= inputMap.value(zoom) * scrollSensitivity * deltaTime;
+        if (inputMap.down(pan)) {
             cameraPosition.x -= input.mouse.position_delta().x * cameraSpeed * deltaTime;
             cameraPosition.y += input.mouse.position_delta().y * cameraSpeed * deltaTime;
         }
@@ -295,7 +308,13 @@ public:
     float fieldOfView { 40 };
     float cameraSpeed { 7.4f };
     float scrollSensitivity { 86 };
-    glm::vec2 lookSensitivity { 1.6f };
+    glm::vec2 lookSensitivity { 0.01f };
+    dst::sys::InputMap inputMap;
+    dst::sys::InputMap::Action toggleAnimation { };
+    dst::sys::InputMap::Action toggleWireFrame { };
+    dst::sys::InputMap::Action rotate { };
+    dst::sys::InputMap::Action pan { };
+    dst::sys::InputMap::Axis zoom { };
     glm::vec3 lightDirection { -5, -5, -10 };
     glm::vec3 cameraPosition { 0, 0, 20 };
     glm::quat worldRotation {
@@ -388,6 +407,8 @@ int main()
         };
 
     gl::Gui gui;
+    gl::DynamicResolution dynamicResolution;
+    bool dynamicResolutionEnabled = true;
     Gear::Renderer renderer;
     dst::Clock clock;
     while (!closeRequested && !window.get_input().keyboard.down(Keyboard::Key::Escape)) {
@@ -397,12 +418,22 @@ int main()
         gui.begin_frame(clock, window);
         ImGui::Checkbox("Animation", &renderer.animation);
         ImGui::Checkbox("Wireframe", &renderer.wireFrame);
+        ImGui::Checkbox("Dynamic Resolution", &dynamicResolutionEnabled);
+        ImGui::Text("Render Scale : %.2f", dynamicResolution.get_scale());
+        ImGui::Text("GPU Time : %.3f ms", dynamicResolution.get_gpu_time() * 1000);
         auto& input = window.get_input();
         if (ImGui::GetIO().WantCaptureMouse) {
             input.revert();
         }
         renderer.update(deltaTime, window.get_input());
-        renderer.draw(deltaTime, window.get_info().extent);
+        if (dynamicResolutionEnabled) {
+            dynamicResolution.update(window.get_frame_stats());
+        } else {
+            dynamicResolution.set_scale(1);
+        }
+        dynamicResolution.begin(window.get_info().extent);
+        renderer.draw(deltaTime, dynamicResolution.get_render_extent());
+        dynamicResolution.end();
         gui.end_frame();
         gui.draw();
         window.swap();
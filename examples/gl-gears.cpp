@@ -35,6 +35,7 @@
 #include "dynamic_static.system.hpp"
 
 #include <array>
+#include <cstring>
 #include <iostream>
 #include <utility>
 #include <vector>
@@ -212,6 +213,19 @@ class Gear::Renderer final
 public:
     inline Renderer()
     {
+        using namespace dst::sys;
+        toggleAnimation = inputMap.add_action();
+        inputMap.bind_action(toggleAnimation, { Keyboard::Key::A });
+        toggleWireFrame = inputMap.add_action();
+        inputMap.bind_action(toggleWireFrame, { Keyboard::Key::W });
+        rotate = inputMap.add_action();
+        inputMap.bind_action(rotate, { }, { Mouse::Button::Left });
+        pan = inputMap.add_action();
+        inputMap.bind_action(pan, { }, { Mouse::Button::Middle });
+        inputMap.bind_action(pan, { }, { Mouse::Button::Right });
+        zoom = inputMap.add_axis();
+        inputMap.bind_axis(zoom, InputMap::Analog::MouseScroll, 1);
+
         gears[0].position = { -3.f, -2.f, 0.0f };
         gears[0].color = { 0.8f, 0.1f, 0.0f, 1.0f };
         gears[1].rotation = 0;
@@ -231,27 +245,30 @@ public:
     inline void update(float deltaTime, const dst::sys::Input& input)
     {
         using namespace dst::sys;
-        if (input.keyboard.pressed(Keyboard::Key::A)) {
+        inputMap.update(input);
+        if (inputMap.pressed(toggleAnimation)) {
             animation = !animation;
         }
-        if (input.keyboard.pressed(Keyboard::Key::W)) {
+        if (inputMap.pressed(toggleWireFrame)) {
             wireFrame = !wireFrame;
         }
-        if (input.mouse.down(Mouse::Button::Left)) {
-            auto look = input.mouse.position_delta() * lookSensitivity * deltaTime;
+        if (inputMap.down(rotate)) {
+            auto look = glm::vec2 { input.mouse.motion_delta() } * lookSensitivity;
             auto rotationX = glm::angleAxis(look.y, glm::vec3 { 1, 0, 0 });
             auto rotationY = glm::angleAxis(look.x, glm::vec3 { 0, 1, 0 });
             worldRotation = glm::normalize(rotationX * rotationY * worldRotation);
         }
-        cameraPosition.z -= input.mouse.scroll_delta() * scrollSensitivity * deltaTime;
-        if (input.mouse.down(Mouse::Button::Middle) ||
-            input.mouse.down(Mouse::Button::Right)) {
+        cameraPosition.z -= inputMap.value(zoom) * scrollSensitivity * deltaTime;
+        if (inputMap.down(pan)) {
             cameraPosition.x -= input.mouse.position_delta().x * cameraSpeed * deltaTime;
             cameraPosition.y += input.mouse.position_delta().y * cameraSpeed * deltaTime;
         }
+        for (auto& gear : gears) {
+            gear.rotation += animation ? gear.speed * deltaTime : 0;
+        }
     }
 
-    inline void draw(float deltaTime, const glm::ivec2& viewport)
+    inline void draw(float interpolationTime, const glm::ivec2& viewport)
     {
         auto viewMatrix = glm::lookAt(
             cameraPosition,
@@ -274,11 +291,11 @@ public:
         dst_gl(glUniformMatrix4fv(projectionLocation, 1, GL_FALSE, &projectionMatrix[0][0]));
         dst_gl(glUniform3fv(lightDirectionLocation, 1, &glm::normalize(lightDirection)[0]));
         for (auto& gear : gears) {
-            gear.rotation += animation ? gear.speed * deltaTime : 0;
+            auto rotation = gear.rotation + (animation ? gear.speed * interpolationTime : 0);
             auto modelMatrix =
                 glm::toMat4(worldRotation) *
                 glm::translate(gear.position) *
-                glm::rotate(glm::radians(gear.rotation), glm::vec3 { 0, 0, 1 });
+                glm::rotate(glm::radians(rotation), glm::vec3 { 0, 0, 1 });
             auto modelViewMatrix = viewMatrix * modelMatrix;
             dst_gl(glUniformMatrix4fv(modelViewLocation, 1, GL_FALSE, &modelViewMatrix[0][0]));
             dst_gl(glUniform4fv(colorLocation, 1, &gear.color[0]));
@@ -293,7 +310,13 @@ public:
     float fieldOfView { 40 };
     float cameraSpeed { 7.4f };
     float scrollSensitivity { 86 };
-    glm::vec2 lookSensitivity { 1.6f };
+    glm::vec2 lookSensitivity { 0.01f };
+    dst::sys::InputMap inputMap;
+    dst::sys::InputMap::Action toggleAnimation { };
+    dst::sys::InputMap::Action toggleWireFrame { };
+    dst::sys::InputMap::Action rotate { };
+    dst::sys::InputMap::Action pan { };
+    dst::sys::InputMap::Axis zoom { };
     glm::vec3 lightDirection { -5, -5, -10 };
     glm::vec3 cameraPosition { 0, 0, 20 };
     glm::quat worldRotation {
@@ -357,7 +380,7 @@ public:
     };
 };
 
-int main()
+int main(int argc, char* argv[])
 {
     std::cout << std::endl;
     std::cout << "[Esc]          - Quit" << std::endl;
@@ -368,6 +391,9 @@ int main()
     std::cout << "[Middle Mouse] - Move model horizontally and vertically" << std::endl;
     std::cout << "[Right Mouse]  - Move model horizontally and vertically" << std::endl;
     std::cout << std::endl;
+    std::cout << "--record <file> - Record input to <file>" << std::endl;
+    std::cout << "--replay <file> - Replay input from <file> with a fixed time step" << std::endl;
+    std::cout << std::endl;
 
     using namespace dst;
     using namespace dst::sys;
@@ -384,15 +410,36 @@ int main()
         {
             closeRequested = true;
         };
+    for (int arg_i = 1; arg_i + 1 < argc; ++arg_i) {
+        if (!strcmp(argv[arg_i], "--record")) {
+            window.begin_input_recording(argv[++arg_i]);
+        } else if (!strcmp(argv[arg_i], "--replay")) {
+            window.begin_input_replay(argv[++arg_i]);
+        }
+    }
+    auto replaying = window.is_replaying_input();
 
+    // NOTE : Input is only consumed by the tick, FrameLoop folds the Input of
+    //  frames that don't run a tick into the next tick so no presses, scroll,
+    //  or mouse motion are dropped when rendering faster than the tick rate.
     Gear::Renderer renderer;
-    dst::Clock clock;
+    FrameLoop::Info frameLoopInfo { };
+    FrameLoop frameLoop(
+        frameLoopInfo,
+        [&](double tickTime, const Input& input)
+        {
+            renderer.update((float)tickTime, input);
+        }
+    );
     while (!closeRequested && !window.get_input().keyboard.down(Keyboard::Key::Escape)) {
-        clock.update();
         Window::poll_events();
-        auto deltaTime = clock.elapsed<dst::Seconds<float>>();
-        renderer.update(deltaTime, window.get_input());
-        renderer.draw(deltaTime, window.get_info().extent);
+        if (replaying && !window.is_replaying_input()) {
+            break;
+        }
+        auto alpha = replaying ?
+            frameLoop.update(window.get_input(), frameLoopInfo.tickTime) :
+            frameLoop.update(window.get_input());
+        renderer.draw((float)(alpha * frameLoopInfo.tickTime), window.get_info().extent);
         window.swap();
     }
     return 0;
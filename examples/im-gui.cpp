@@ -17,9 +17,12 @@ int main(int argc, char* argv[])
 {
     using namespace dst;
     using namespace dst::sys;
+    System system;
+    system.begin_prewarm();
     Window::GlInfo glInfo { };
     Window::Info windowInfo { };
     windowInfo.pName = "Dynamic_Static ImGui";
+    windowInfo.flags |= Window::Info::Flags::ThrottleBackground;
     windowInfo.pGlInfo = &glInfo;
     Window window(windowInfo);
     Delegate<const Window&> window_close_requested_handler;
@@ -31,19 +34,35 @@ int main(int argc, char* argv[])
             closeRequested = true;
         };
 
-    gl::Gui gui;
+    system.end_prewarm();
+    gl::Gui gui(system.get_font_atlas());
     dst::Clock clock;
     while (!closeRequested && !window.get_input().keyboard.down(Keyboard::Key::Escape)) {
         clock.update();
         Window::poll_events();
-        gui.begin_frame(clock, window);
-        ImGui::ShowDemoWindow();
-        auto viewport = window.get_info().extent;
-        dst_gl(glViewport(0, 0, viewport.x, viewport.y));
-        dst_gl(glClearColor(0, 0, 0, 0));
-        dst_gl(glClear(GL_COLOR_BUFFER_BIT));
-        gui.end_frame();
-        gui.draw();
+        auto& frameStats = window.get_frame_stats();
+        {
+            FrameStats::ScopedPhase updatePhase(frameStats, FrameStats::Phase::Update);
+            gui.begin_frame(clock, window);
+            ImGui::ShowDemoWindow();
+            auto frameSummary = frameStats.get_summary(FrameStats::Phase::Frame);
+            ImGui::Begin("Frame Stats", nullptr, ImGuiWindowFlags_AlwaysAutoResize);
+            ImGui::Text("p50 : %.3f ms", frameSummary.p50 * 1000);
+            ImGui::Text("p95 : %.3f ms", frameSummary.p95 * 1000);
+            ImGui::Text("p99 : %.3f ms", frameSummary.p99 * 1000);
+            ImGui::Text("max : %.3f ms", frameSummary.max * 1000);
+            ImGui::Text("Hitches : %llu", (unsigned long long)frameStats.get_hitch_count());
+            ImGui::End();
+        }
+        {
+            FrameStats::ScopedPhase drawPhase(frameStats, FrameStats::Phase::Draw);
+            auto viewport = window.get_info().extent;
+            dst_gl(glViewport(0, 0, viewport.x, viewport.y));
+            dst_gl(glClearColor(0, 0, 0, 0));
+            dst_gl(glClear(GL_COLOR_BUFFER_BIT));
+            gui.end_frame();
+            gui.draw();
+        }
         window.swap();
     }
     return 0;
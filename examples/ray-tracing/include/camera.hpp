@@ -19,24 +19,40 @@
 #include "dynamic_static/core/time.hpp"
 #include "dynamic_static/core/transform.hpp"
 #include "dynamic_static/system/input.hpp"
+#include "dynamic_static/system/input-map.hpp"
+
+#include <memory>
 
 namespace rtow {
 
 class Camera final
 {
 public:
+    inline Camera()
+    {
+        using namespace dst::sys;
+        mInputMap = std::make_shared<InputMap>();
+        mMoveX = mInputMap->add_axis();
+        mInputMap->bind_axis(mMoveX, Keyboard::Key::D, 1);
+        mInputMap->bind_axis(mMoveX, Keyboard::Key::A, -1);
+        mMoveY = mInputMap->add_axis();
+        mInputMap->bind_axis(mMoveY, Keyboard::Key::Q, 1);
+        mInputMap->bind_axis(mMoveY, Keyboard::Key::E, -1);
+        mMoveZ = mInputMap->add_axis();
+        mInputMap->bind_axis(mMoveZ, Keyboard::Key::W, 1);
+        mInputMap->bind_axis(mMoveZ, Keyboard::Key::S, -1);
+    }
+
     inline void update(const dst::Clock& clock, const dst::sys::Input& input)
     {
         using namespace dst::sys;
         auto deltaTime = clock.elapsed<dst::Seconds<float>>();
+        mInputMap->update(input);
         if (moveEnabled) {
             glm::vec3 direction { };
-            direction += input.keyboard.down(Keyboard::Key::Q) ? transform.up() : glm::vec3 { };
-            direction += input.keyboard.down(Keyboard::Key::E) ? transform.down() : glm::vec3 { };
-            direction += input.keyboard.down(Keyboard::Key::A) ? transform.left() : glm::vec3 { };
-            direction += input.keyboard.down(Keyboard::Key::D) ? transform.right() : glm::vec3 { };
-            direction += input.keyboard.down(Keyboard::Key::W) ? transform.forward() : glm::vec3 { };
-            direction += input.keyboard.down(Keyboard::Key::S) ? transform.backward() : glm::vec3 { };
+            direction += transform.right() * mInputMap->value(mMoveX);
+            direction += transform.up() * mInputMap->value(mMoveY);
+            direction += transform.forward() * mInputMap->value(mMoveZ);
             if (direction.x || direction.y || direction.z) {
                 direction = glm::normalize(direction);
             }
@@ -44,7 +60,7 @@ public:
         }
         if (lookEnabled) {
             float verticalLookMax = glm::radians(90.0f);
-            auto look = input.mouse.position_delta() * sensitivity * deltaTime;
+            auto look = glm::vec2 { input.mouse.motion_delta() } * sensitivity;
             if (verticalLookMax < mVerticalLook + look.y) {
                 look.y = verticalLookMax - mVerticalLook;
             } else
@@ -99,7 +115,7 @@ public:
     bool moveEnabled { true };
     bool lookEnabled { true };
     float speed { 4.2f };
-    glm::vec2 sensitivity { 2.0f, 2.0f };
+    glm::vec2 sensitivity { 0.003f, 0.003f };
 
 private:
     glm::vec2 mViewport { };
@@ -108,6 +124,12 @@ private:
     glm::vec3 mLowerLeftCorner { };
 
     float mVerticalLook { };
+    // NOTE : The InputMap is shared so that the copies the RayTracer makes for
+    //  its Uniforms don't copy the InputMap's tables.
+    std::shared_ptr<dst::sys::InputMap> mInputMap;
+    dst::sys::InputMap::Axis mMoveX { };
+    dst::sys::InputMap::Axis mMoveY { };
+    dst::sys::InputMap::Axis mMoveZ { };
 };
 
 } // namespace rtow
@@ -45,6 +45,7 @@ public:
     virtual bool hit(const Ray& ray, float tMin, float tMax, Record& record) const = 0;
     virtual void gui();
     virtual void draw(const Camera& camera);
+    void draw(const glm::mat4& model, const glm::mat4& view, const glm::mat4& projection);
     dst::Transform transform;
 
 protected:
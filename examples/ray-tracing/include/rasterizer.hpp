@@ -17,6 +17,9 @@
 #include "renderer.hpp"
 #include "scene.hpp"
 
+#include <cassert>
+#include <vector>
+
 namespace rtow {
 
 class Rasterizer final
@@ -28,16 +31,30 @@ public:
     {
     }
 
+    // NOTE : update() builds the draw list without touching OpenGL so that it
+    //  can run on any thread, on_draw() only submits it.
     inline void update(const Camera& camera, const Scene& scene) override final
     {
+        mView = camera.view();
+        mProjection = camera.projection();
+        mModels.clear();
+        for (auto const& object : scene.hittables) {
+            mModels.push_back(glm::translate(object->transform.translation));
+        }
     }
 
     inline void on_draw(const Camera& camera, const Scene& scene) override final
     {
-        for (auto const& object : scene.hittables) {
-            object->draw(camera);
+        assert(mModels.size() == scene.hittables.size());
+        for (size_t i = 0; i < scene.hittables.size(); ++i) {
+            scene.hittables[i]->draw(mModels[i], mView, mProjection);
         }
     }
+
+private:
+    glm::mat4 mView { };
+    glm::mat4 mProjection { };
+    std::vector<glm::mat4> mModels;
 };
 
 } // namespace rtow
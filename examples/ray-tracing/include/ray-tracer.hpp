@@ -115,6 +115,11 @@ public:
         mVisualizer.draw(mPixels);
     }
 
+    inline const dst::sys::gl::Texture& get_texture() const
+    {
+        return mVisualizer.get_texture();
+    }
+
     inline void stop()
     {
         mStop = true;
@@ -236,6 +241,11 @@ private:
             mMesh.draw_indexed();
         }
 
+        inline const dst::sys::gl::Texture& get_texture() const
+        {
+            return mTexture;
+        }
+
     private:
         dst::sys::gl::Mesh mMesh;
         dst::sys::gl::Texture mTexture;
@@ -56,7 +56,6 @@ public:
         if (postDrawFunction) {
             postDrawFunction();
         }
-        mpWindow->swap();
     }
 
 protected:
@@ -34,13 +34,15 @@ void Hittable::gui()
 }
 
 void Hittable::draw(const Camera& camera)
+{
+    draw(glm::translate(transform.translation), camera.view(), camera.projection());
+}
+
+void Hittable::draw(const glm::mat4& model, const glm::mat4& view, const glm::mat4& projection)
 {
     if (mpMaterial) {
-        auto modelMatrix = glm::translate(transform.translation);
-        auto view = camera.view();
-        auto projection = camera.projection();
         mpMaterial->bind();
-        dst_gl(glUniformMatrix4fv(mpMaterial->get_uniform_location("model"), 1, GL_FALSE, &modelMatrix[0][0]));
+        dst_gl(glUniformMatrix4fv(mpMaterial->get_uniform_location("model"), 1, GL_FALSE, &model[0][0]));
         dst_gl(glUniformMatrix4fv(mpMaterial->get_uniform_location("view"), 1, GL_FALSE, &view[0][0]));
         dst_gl(glUniformMatrix4fv(mpMaterial->get_uniform_location("projection"), 1, GL_FALSE, &projection[0][0]));
         mMesh.draw_indexed();
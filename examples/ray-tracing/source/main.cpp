@@ -23,6 +23,8 @@
 #include "dynamic_static.core.hpp"
 #include "dynamic_static.system.hpp"
 
+#include <array>
+
 int main(int argc, char* argv[])
 {
     dst::sys::Window::GlInfo glInfo { };
@@ -38,6 +40,7 @@ int main(int argc, char* argv[])
     windowInfo.pGlInfo = &glInfo;
     dst::sys::Window rayTracingWindow(windowInfo);
     windowInfo.pName = "Dynamic_Static Ray Tracing (Rasterized View)";
+    windowInfo.pShareWindow = &rayTracingWindow;
     dst::sys::Window rasterizerWindow(windowInfo);
     bool close = false;
     dst::Delegate<const dst::sys::Window&> on_window_close([&](const auto& window) { close = true; });
@@ -87,65 +90,119 @@ int main(int argc, char* argv[])
     //     )
     // );
 
-    for (dst::Clock clock;
+    // NOTE : Each frame runs as a TaskGraph.  Polling events and everything that
+    //  touches OpenGL has Affinity::Caller so it runs on the main thread with the
+    //  Windows' contexts, updating the Camera and building the rasterized draw
+    //  list have Affinity::Any and run on worker threads.
+    using Affinity = dst::sys::TaskGraph::Affinity;
+    std::array<dst::sys::Window*, 2> windows { &rayTracingWindow, &rasterizerWindow };
+    dst::Clock clock;
+    rtow::Camera rasterizedCamera;
+    dst::sys::TaskGraph taskGraph;
+    auto inputTask = taskGraph.add_task(
+        [&]()
+        {
+            dst::sys::Window::poll_events();
+        },
+        Affinity::Caller
+    );
+    auto cameraTask = taskGraph.add_task(
+        [&]()
+        {
+            camera.lookEnabled = rasterizerWindow.get_input().mouse.down(dst::sys::Mouse::Button::Left);
+            camera.update(clock, rasterizerWindow.get_input());
+        }
+    );
+    auto drawListTask = taskGraph.add_task(
+        [&]()
+        {
+            rasterizedCamera = camera;
+            rasterizedCamera.extent = rasterizerWindow.get_info().extent;
+            rasterizer.update(rasterizedCamera, scene);
+        }
+    );
+    auto rayTracedViewTask = taskGraph.add_task(
+        [&]()
+        {
+            auto rayTracedCamera = camera;
+            rayTracedCamera.extent = rayTracingWindow.get_info().extent;
+            rayTracer.draw(rayTracedCamera, scene);
+        },
+        Affinity::Caller
+    );
+    auto rasterizedViewTask = taskGraph.add_task(
+        [&]()
+        {
+            rasterizer.draw(
+                rasterizedCamera,
+                scene,
+                [&]()
+                {
+                    gui.begin_frame(clock, rasterizerWindow);
+                    ImGui::Begin("Settings", nullptr, ImGuiWindowFlags_AlwaysAutoResize);
+                    if (rayTracer.get_progress() < 1.0f) {
+                        ImGui::ProgressBar(rayTracer.get_progress());
+                    } else {
+                        if (ImGui::Button("Update Ray Traced View")) {
+                            rayTracer.update(camera, scene);
+                        }
+                    }
+                    // NOTE : The ray traced view's texture is created in the ray traced
+                    //  Window's context, it's drawn here in the rasterized Window's
+                    //  context because the rasterized Window shares with it.
+                    const auto& rayTracedTexture = rayTracer.get_texture();
+                    auto previewWidth = 240.0f;
+                    auto previewHeight = previewWidth * (float)rayTracedTexture.info().height / (float)rayTracedTexture.info().width;
+                    ImGui::Image((ImTextureID)&rayTracedTexture, { previewWidth, previewHeight }, { 0, 1 }, { 1, 0 });
+                    ImGui::Text("Update time : %f ms", rayTracer.get_time_taken<dst::Milliseconds<float>>());
+                    ImGui::Text("Update time : %f s", rayTracer.get_time_taken<dst::Seconds<float>>());
+                    ImGui::Text("Update time : %f m", rayTracer.get_time_taken<dst::Minutes<float>>());
+                    const auto& lookLatency = rasterizerWindow.get_latency_stats().get_histogram(dst::sys::Input::Event::Type::MousePosition);
+                    ImGui::Text("Look latency p50 : %.1f ms", lookLatency.get_percentile(0.50) * 1000);
+                    ImGui::Text("Look latency p95 : %.1f ms", lookLatency.get_percentile(0.95) * 1000);
+                    ImGui::Text("Look latency p99 : %.1f ms", lookLatency.get_percentile(0.99) * 1000);
+                    ImGui::DragInt("Max Recursion Depth", &rayTracer.maxRecursionDepth, 1.0f, 1, 128);
+                    ImGui::DragInt("MSAA Sample Count", &rayTracer.msaaSampleCount, 1.0f, 1, 128);
+                    if (ImGui::GetIO().WantCaptureMouse) {
+                        // rasterizerWindow.get_input().revert();
+                    }
+                    if (1 <= rayTracer.get_progress()) {
+                        for (const auto& object : scene.hittables) {
+                            ImGui::PushID(&object);
+                            object->gui();
+                            ImGui::PopID();
+                        }
+                    }
+                },
+                [&]()
+                {
+                    ImGui::End();
+                    gui.end_frame();
+                    gui.draw();
+                }
+            );
+        },
+        Affinity::Caller
+    );
+    auto presentTask = taskGraph.add_task(
+        [&]()
+        {
+            dst::sys::Window::present(windows);
+        },
+        Affinity::Caller
+    );
+    taskGraph.add_dependency(cameraTask, inputTask);
+    taskGraph.add_dependency(drawListTask, cameraTask);
+    taskGraph.add_dependency(rayTracedViewTask, cameraTask);
+    taskGraph.add_dependency(rasterizedViewTask, drawListTask);
+    taskGraph.add_dependency(rasterizedViewTask, rayTracedViewTask);
+    taskGraph.add_dependency(presentTask, rasterizedViewTask);
+    for (;
         !close &&
         !rasterizerWindow.get_input().keyboard.down(dst::sys::Keyboard::Key::Escape) &&
         !rayTracingWindow.get_input().keyboard.down(dst::sys::Keyboard::Key::Escape);
         clock.update()) {
-        camera.extent = rayTracingWindow.get_info().extent;
-        rayTracer.draw(camera, scene);
-        camera.extent = rasterizerWindow.get_info().extent;
-        rasterizer.update(camera, scene);
-        rasterizer.draw(
-            camera,
-            scene,
-            [&]()
-            {
-                gui.begin_frame(clock, rasterizerWindow);
-                ImGui::Begin("Settings", nullptr, ImGuiWindowFlags_AlwaysAutoResize);
-                if (rayTracer.get_progress() < 1.0f) {
-                    ImGui::ProgressBar(rayTracer.get_progress());
-                } else {
-                    if (ImGui::Button("Update Ray Traced View")) {
-                        rayTracer.update(camera, scene);
-                    }
-                }
-                ImGui::Text("Update time : %f ms", rayTracer.get_time_taken<dst::Milliseconds<float>>());
-                ImGui::Text("Update time : %f s", rayTracer.get_time_taken<dst::Seconds<float>>());
-                ImGui::Text("Update time : %f m", rayTracer.get_time_taken<dst::Minutes<float>>());
-                ImGui::DragInt("Max Recursion Depth", &rayTracer.maxRecursionDepth, 1.0f, 1, 128);
-                ImGui::DragInt("MSAA Sample Count", &rayTracer.msaaSampleCount, 1.0f, 1, 128);
-                if (ImGui::GetIO().WantCaptureMouse) {
-                    // rasterizerWindow.get_input().revert();
-                }
-                if (1 <= rayTracer.get_progress()) {
-                    for (const auto& object : scene.hittables) {
-                        ImGui::PushID(&object);
-                        object->gui();
-                        ImGui::PopID();
-                    }
-                }
-            },
-            [&]()
-            {
-                ImGui::End();
-                gui.end_frame();
-                gui.draw();
-            }
-        );
-        camera.lookEnabled = rasterizerWindow.get_input().mouse.down(dst::sys::Mouse::Button::Left);
-        camera.update(clock, rasterizerWindow.get_input());
-#if 0
-        const auto& input = rasterizerWindow.get_input();
-        auto deltaTime = clock.elapsed<dst::Milliseconds<float>>();
-        camera.transform.translation.z -= input.mouse.scroll_delta() * 0.1f * deltaTime;
-        if (input.mouse.down(dst::sys::Mouse::Button::Middle) ||
-            input.mouse.down(dst::sys::Mouse::Button::Right)) {
-            camera.transform.translation.x -= input.mouse.position_delta().x * 0.004f * deltaTime;
-            camera.transform.translation.y += input.mouse.position_delta().y * 0.004f * deltaTime;
-        }
-#endif
-        dst::sys::Window::poll_events();
+        taskGraph.run();
     }
     return 0;
 }
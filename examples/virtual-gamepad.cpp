@@ -0,0 +1,88 @@
+
+/*
+==========================================
+  Copyright (c) 2020 Dynamic_Static
+    Patrick Purcell
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#include "dynamic_static.core.hpp"
+#include "dynamic_static.system.hpp"
+
+#include <iostream>
+#include <memory>
+
+int main(int argc, char* argv[])
+{
+    using namespace dst;
+    using namespace dst::sys;
+    Window::GlInfo glInfo { };
+    Window::Info windowInfo { };
+    windowInfo.pName = "Dynamic_Static Virtual Gamepad";
+    windowInfo.flags |= Window::Info::Flags::ThrottleBackground;
+    windowInfo.pGlInfo = &glInfo;
+    Window window(windowInfo);
+    Delegate<const Window&> window_close_requested_handler;
+    window.on_close_requested += window_close_requested_handler;
+    bool closeRequested = false;
+    window_close_requested_handler =
+        [&](const Window&)
+        {
+            closeRequested = true;
+        };
+
+    // NOTE : The Keyboard drives a Gamepad::VirtualSource in place of a real
+    //  device, G toggles the connection, the arrow keys push the left stick,
+    //  and the SpaceBar holds Gamepad::Button::A.  Changes are picked up by the
+    //  next call to Window::poll_events() and reported as Input::Events.
+    auto virtualGamepad = std::make_shared<Gamepad::VirtualSource>();
+    Window::set_gamepad_source(virtualGamepad);
+    std::cout << "G : connect/disconnect, Arrows : left stick, SpaceBar : A, Escape : exit" << std::endl;
+    bool connected = false;
+    while (!closeRequested && !window.get_input().keyboard.down(Keyboard::Key::Escape)) {
+        Window::poll_events();
+        const auto& input = window.get_input();
+        const auto& keyboard = input.keyboard;
+        if (keyboard.pressed(Keyboard::Key::G)) {
+            connected = !connected;
+            virtualGamepad->set_connected(0, connected);
+        }
+        if (connected) {
+            auto x = (float)keyboard.down(Keyboard::Key::RightArrow) - (float)keyboard.down(Keyboard::Key::LeftArrow);
+            auto y = (float)keyboard.down(Keyboard::Key::DownArrow) - (float)keyboard.down(Keyboard::Key::UpArrow);
+            virtualGamepad->set(0, Gamepad::Axis::LeftX, x);
+            virtualGamepad->set(0, Gamepad::Axis::LeftY, y);
+            virtualGamepad->set(0, Gamepad::Button::A, keyboard.down(Keyboard::Key::SpaceBar));
+        }
+        for (const auto& event : input.get_events()) {
+            switch (event.type) {
+            case Input::Event::Type::GamepadConnection: {
+                std::cout << "Gamepad " << event.code << (event.action == Input::Event::Action::Press ? " connected" : " disconnected") << std::endl;
+            } break;
+            case Input::Event::Type::GamepadButton: {
+                std::cout << "Gamepad " << event.get_gamepad_index() << " button " << event.get_gamepad_element() << (event.action == Input::Event::Action::Press ? " pressed" : " released") << std::endl;
+            } break;
+            case Input::Event::Type::GamepadAxis: {
+                std::cout << "Gamepad " << event.get_gamepad_index() << " axis " << event.get_gamepad_element() << " : " << event.value.x << std::endl;
+            } break;
+            default: {
+            } break;
+            }
+        }
+        const auto& gamepad = input.gamepad;
+        auto viewport = window.get_info().extent;
+        dst_gl(glViewport(0, 0, viewport.x, viewport.y));
+        dst_gl(glClearColor(
+            gamepad.axis(0, Gamepad::Axis::LeftX) * 0.5f + 0.5f,
+            gamepad.axis(0, Gamepad::Axis::LeftY) * 0.5f + 0.5f,
+            gamepad.down(0, Gamepad::Button::A) ? 1.0f : 0.0f,
+            1
+        ));
+        dst_gl(glClear(GL_COLOR_BUFFER_BIT));
+        window.swap();
+    }
+    Window::set_gamepad_source(nullptr);
+    return 0;
+}
@@ -10,8 +10,15 @@
 
 #pragma once
 
+#include "dynamic_static/system/allocation-tracker.hpp"
 #include "dynamic_static/system/defines.hpp"
+#include "dynamic_static/system/frame-allocator.hpp"
+#include "dynamic_static/system/frame-loop.hpp"
 #include "dynamic_static/system/gui.hpp"
 #include "dynamic_static/system/input.hpp"
+#include "dynamic_static/system/input-history.hpp"
+#include "dynamic_static/system/input-map.hpp"
 #include "dynamic_static/system/opengl.hpp"
+#include "dynamic_static/system/system.hpp"
+#include "dynamic_static/system/task-graph.hpp"
 #include "dynamic_static/system/window.hpp"
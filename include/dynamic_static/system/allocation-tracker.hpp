@@ -0,0 +1,130 @@
+
+/*
+==========================================
+  Copyright (c) 2020 Dynamic_Static
+    Patrick Purcell
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#pragma once
+
+#include "dynamic_static/system/defines.hpp"
+
+#include <filesystem>
+#include <vector>
+
+#ifdef DYNAMIC_STATIC_SYSTEM_ALLOCATION_TRACKING_ENABLED
+#define dst_allocation_scope_concatenate_impl(A, B) A##B
+#define dst_allocation_scope_concatenate(A, B) dst_allocation_scope_concatenate_impl(A, B)
+#define dst_allocation_scope(NAME) dst::sys::AllocationTracker::Scope dst_allocation_scope_concatenate(dstAllocationScope, __LINE__)(NAME)
+#else
+#define dst_allocation_scope(NAME)
+#endif
+
+namespace dst {
+namespace sys {
+
+/**
+Counts heap allocations made through global operator new and operator delete
+    @note Allocations are only counted when dynamic_static.system is built with DST_SYS_TRACK_ALLOCATIONS, otherwise every count is 0
+    @note Frames are delimited by Window::poll_events() and Window::wait_events(), counts are process wide
+*/
+class AllocationTracker final
+{
+public:
+    static constexpr size_t SiteCapacity { 256 }; //!< The maximum number of distinct call sites tracked, allocations from additional call sites are counted as untagged
+
+    /**
+    Specifies heap activity counts
+    */
+    struct Counts final
+    {
+        uint64_t allocationCount { 0 };   //!< The number of allocations
+        uint64_t allocatedBytes { 0 };    //!< The number of bytes allocated
+        uint64_t deallocationCount { 0 }; //!< The number of deallocations
+    };
+
+    /**
+    Specifies heap activity counts for a call site
+    */
+    struct Site final
+    {
+        const char* pName { nullptr }; //!< The name of the call site, "untagged" for allocations made outside of any Scope
+        Counts total { };              //!< The counts since tracking began
+        Counts lastFrame { };          //!< The counts for the most recently completed frame
+        Counts maxFrame { };           //!< The largest per frame counts, each member is tracked independently
+    };
+
+    /**
+    Attributes allocations made on the calling thread to a named call site for the lifetime of a Scope
+        @note Use the dst_allocation_scope() macro so that Scopes compile away when tracking is disabled
+        @note Scopes are matched by name pointer, the name must outlive tracking, string literals are recommended
+    */
+    class Scope final
+    {
+    public:
+        /**
+        Constructs an instance of Scope
+        @param [in] pName The name of the call site to attribute allocations to
+        */
+        Scope(const char* pName);
+
+        /**
+        Destroys this instance of Scope, restoring the previous call site
+        */
+        ~Scope();
+
+    private:
+        const char* mpPreviousName { nullptr };
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+    };
+
+    /**
+    Gets a value indicating whether or not allocation tracking is enabled
+    @return Whether or not allocation tracking is enabled
+    */
+    static bool enabled();
+
+    /**
+    Ends the current frame and begins the next one
+        @note This method is called by Window::poll_events() and Window::wait_events() and doesn't normally need to be called manually
+    */
+    static void begin_frame();
+
+    /**
+    Gets the index of the current frame
+    @return The index of the current frame
+    */
+    static uint64_t get_frame_index();
+
+    /**
+    Gets the Counts for the most recently completed frame
+    @return The Counts for the most recently completed frame
+    */
+    static Counts get_last_frame_counts();
+
+    /**
+    Gets the Counts since tracking began
+    @return The Counts since tracking began
+    */
+    static Counts get_total_counts();
+
+    /**
+    Gets the Counts for each call site that has allocated
+    @param [out] pSites The std::vector<Site> to populate
+    */
+    static void get_sites(std::vector<Site>* pSites);
+
+    /**
+    Writes the Counts for each call site to a file
+        @note Throws std::runtime_error if the file can't be opened
+    @param [in] filePath The path of the file to write
+    */
+    static void write(const std::filesystem::path& filePath);
+};
+
+} // namespace sys
+} // namespace dst
@@ -0,0 +1,395 @@
+
+/*
+==========================================
+  Copyright (c) 2020 Dynamic_Static
+    Patrick Purcell
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#pragma once
+
+#include "dynamic_static/system/defines.hpp"
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace dst {
+namespace sys {
+namespace detail {
+
+/**
+Gets the number of set bits in a given word
+@param [in] word The word to count the set bits of
+@return The number of set bits in the given word
+*/
+inline size_t count_set_bits(uint64_t word)
+{
+    #ifdef _MSC_VER
+    return (size_t)__popcnt64(word);
+    #else
+    return (size_t)__builtin_popcountll(word);
+    #endif
+}
+
+/**
+Gets the index of the lowest set bit in a given word
+@param [in] word The word to get the index of the lowest set bit of, must not be 0
+@return The index of the lowest set bit in the given word
+*/
+inline size_t get_lowest_set_bit(uint64_t word)
+{
+    assert(word);
+    #ifdef _MSC_VER
+    unsigned long index = 0;
+    _BitScanForward64(&index, word);
+    return (size_t)index;
+    #else
+    return (size_t)__builtin_ctzll(word);
+    #endif
+}
+
+} // namespace detail
+
+/**
+Provides fixed size storage for bits packed into explicitly aligned 64 bit words
+    @note Bitwise operators work a word at a time, iterating a BitSet visits the index of each set bit
+*/
+template <size_t BitCount>
+class BitSet final
+{
+public:
+    using Word = uint64_t; //!< The type of word bits are packed into
+
+    static constexpr size_t WordBitCount { sizeof(Word) * 8 };                          //!< The number of bits in each Word
+    static constexpr size_t WordCount { (BitCount + WordBitCount - 1) / WordBitCount }; //!< The number of Words in a BitSet
+    static constexpr size_t Alignment {                                                 //!< The alignment of a BitSet object's Words, a BitSet never straddles a cache line unless it's larger than one
+        WordCount * sizeof(Word) <= 8 ? 8 :
+        WordCount * sizeof(Word) <= 16 ? 16 :
+        WordCount * sizeof(Word) <= 32 ? 32 : 64
+    };
+
+    /**
+    Iterates over the indices of the set bits in a BitSet
+    */
+    class Iterator final
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag; //!< This Iterator's category
+        using value_type = size_t;                           //!< The type of value this Iterator produces
+        using difference_type = std::ptrdiff_t;              //!< The type of the difference between two Iterators
+        using pointer = const size_t*;                       //!< The type of pointer to the value this Iterator produces
+        using reference = size_t;                            //!< The type of reference to the value this Iterator produces
+
+        /**
+        Gets the index of the set bit this Iterator is at
+        @return The index of the set bit this Iterator is at
+        */
+        inline size_t operator*() const
+        {
+            return mWord_i * WordBitCount + detail::get_lowest_set_bit(mWord);
+        }
+
+        /**
+        Advances this Iterator to the next set bit
+        @return This Iterator
+        */
+        inline Iterator& operator++()
+        {
+            mWord &= mWord - 1;
+            seek();
+            return *this;
+        }
+
+        /**
+        Advances this Iterator to the next set bit
+        @return A copy of this Iterator before it was advanced
+        */
+        inline Iterator operator++(int)
+        {
+            auto iterator = *this;
+            ++(*this);
+            return iterator;
+        }
+
+        /**
+        Gets a value indicating whether or not two Iterators are at the same bit
+        */
+        inline bool operator==(const Iterator& other) const
+        {
+            return mWord_i == other.mWord_i && mWord == other.mWord;
+        }
+
+        /**
+        Gets a value indicating whether or not two Iterators are at different bits
+        */
+        inline bool operator!=(const Iterator& other) const
+        {
+            return !(*this == other);
+        }
+
+    private:
+        friend class BitSet;
+        inline Iterator(const BitSet* pBitSet, size_t word_i)
+            : mpBitSet { pBitSet }
+            , mWord_i { word_i }
+            , mWord { word_i < WordCount ? pBitSet->mWords[word_i] : 0 }
+        {
+            seek();
+        }
+
+        inline void seek()
+        {
+            while (!mWord && mWord_i < WordCount) {
+                if (++mWord_i < WordCount) {
+                    mWord = mpBitSet->mWords[mWord_i];
+                }
+            }
+        }
+
+        const BitSet* mpBitSet { nullptr };
+        size_t mWord_i { 0 };
+        Word mWord { 0 };
+    };
+
+    /**
+    Gets the number of bits in this BitSet
+    @return The number of bits in this BitSet
+    */
+    inline constexpr size_t size() const
+    {
+        return BitCount;
+    }
+
+    /**
+    Gets the value of a given bit
+    @param [in] index The index of the bit to get
+    @return The value of the given bit
+    */
+    inline bool operator[](size_t index) const
+    {
+        return test(index);
+    }
+
+    /**
+    Gets the value of a given bit
+    @param [in] index The index of the bit to get
+    @return The value of the given bit
+    */
+    inline bool test(size_t index) const
+    {
+        assert(index < BitCount);
+        return (mWords[index / WordBitCount] >> (index % WordBitCount)) & 1;
+    }
+
+    /**
+    Sets the value of a given bit
+    @param [in] index The index of the bit to set
+    @param [in] value (optional = true) The value to set
+    @return This BitSet
+    */
+    inline BitSet& set(size_t index, bool value = true)
+    {
+        assert(index < BitCount);
+        auto& word = mWords[index / WordBitCount];
+        auto mask = (Word)1 << (index % WordBitCount);
+        word = value ? word | mask : word & ~mask;
+        return *this;
+    }
+
+    /**
+    Clears a given bit
+    @param [in] index The index of the bit to clear
+    @return This BitSet
+    */
+    inline BitSet& reset(size_t index)
+    {
+        return set(index, false);
+    }
+
+    /**
+    Clears every bit in this BitSet
+    @return This BitSet
+    */
+    inline BitSet& reset()
+    {
+        mWords.fill(0);
+        return *this;
+    }
+
+    /**
+    Gets a value indicating whether or not any bit in this BitSet is set
+    @return Whether or not any bit in this BitSet is set
+    */
+    inline bool any() const
+    {
+        for (auto word : mWords) {
+            if (word) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+    Gets a value indicating whether or not every bit in this BitSet is clear
+    @return Whether or not every bit in this BitSet is clear
+    */
+    inline bool none() const
+    {
+        return !any();
+    }
+
+    /**
+    Gets the number of set bits in this BitSet
+    @return The number of set bits in this BitSet
+    */
+    inline size_t count() const
+    {
+        size_t count = 0;
+        for (auto word : mWords) {
+            count += detail::count_set_bits(word);
+        }
+        return count;
+    }
+
+    /**
+    Gets this BitSet object's Words
+        @note Bits beyond BitCount are always clear
+    @return This BitSet object's Words
+    */
+    inline const std::array<Word, WordCount>& get_words() const
+    {
+        return mWords;
+    }
+
+    /**
+    Gets an Iterator at this BitSet object's lowest set bit
+    @return An Iterator at this BitSet object's lowest set bit
+    */
+    inline Iterator begin() const
+    {
+        return Iterator(this, 0);
+    }
+
+    /**
+    Gets an Iterator past this BitSet object's highest set bit
+    @return An Iterator past this BitSet object's highest set bit
+    */
+    inline Iterator end() const
+    {
+        return Iterator(this, WordCount);
+    }
+
+    /**
+    Gets a copy of this BitSet with every bit flipped
+    @return A copy of this BitSet with every bit flipped
+    */
+    inline BitSet operator~() const
+    {
+        BitSet bitSet;
+        for (size_t word_i = 0; word_i < WordCount; ++word_i) {
+            bitSet.mWords[word_i] = ~mWords[word_i];
+        }
+        bitSet.mWords[WordCount - 1] &= LastWordMask;
+        return bitSet;
+    }
+
+    /**
+    Sets this BitSet to the bitwise AND of this BitSet and another BitSet
+    @param [in] other The BitSet to AND with
+    @return This BitSet
+    */
+    inline BitSet& operator&=(const BitSet& other)
+    {
+        for (size_t word_i = 0; word_i < WordCount; ++word_i) {
+            mWords[word_i] &= other.mWords[word_i];
+        }
+        return *this;
+    }
+
+    /**
+    Sets this BitSet to the bitwise OR of this BitSet and another BitSet
+    @param [in] other The BitSet to OR with
+    @return This BitSet
+    */
+    inline BitSet& operator|=(const BitSet& other)
+    {
+        for (size_t word_i = 0; word_i < WordCount; ++word_i) {
+            mWords[word_i] |= other.mWords[word_i];
+        }
+        return *this;
+    }
+
+    /**
+    Sets this BitSet to the bitwise XOR of this BitSet and another BitSet
+    @param [in] other The BitSet to XOR with
+    @return This BitSet
+    */
+    inline BitSet& operator^=(const BitSet& other)
+    {
+        for (size_t word_i = 0; word_i < WordCount; ++word_i) {
+            mWords[word_i] ^= other.mWords[word_i];
+        }
+        return *this;
+    }
+
+    /**
+    Gets the bitwise AND of two BitSets
+    */
+    inline friend BitSet operator&(const BitSet& lhs, const BitSet& rhs)
+    {
+        auto bitSet = lhs;
+        return bitSet &= rhs;
+    }
+
+    /**
+    Gets the bitwise OR of two BitSets
+    */
+    inline friend BitSet operator|(const BitSet& lhs, const BitSet& rhs)
+    {
+        auto bitSet = lhs;
+        return bitSet |= rhs;
+    }
+
+    /**
+    Gets the bitwise XOR of two BitSets
+    */
+    inline friend BitSet operator^(const BitSet& lhs, const BitSet& rhs)
+    {
+        auto bitSet = lhs;
+        return bitSet ^= rhs;
+    }
+
+    /**
+    Gets a value indicating whether or not two BitSets have the same bits set
+    */
+    inline friend bool operator==(const BitSet& lhs, const BitSet& rhs)
+    {
+        return lhs.mWords == rhs.mWords;
+    }
+
+    /**
+    Gets a value indicating whether or not two BitSets have different bits set
+    */
+    inline friend bool operator!=(const BitSet& lhs, const BitSet& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+private:
+    static_assert(BitCount, "BitSet must have at least one bit");
+    static constexpr Word LastWordMask { BitCount % WordBitCount ? ((Word)1 << (BitCount % WordBitCount)) - 1 : ~(Word)0 };
+    alignas(Alignment) std::array<Word, WordCount> mWords { };
+};
+
+} // namespace sys
+} // namespace dst
@@ -0,0 +1,201 @@
+
+/*
+==========================================
+  Copyright (c) 2020 Dynamic_Static
+    Patrick Purcell
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#pragma once
+
+#include "dynamic_static/system/defines.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace dst {
+namespace sys {
+
+/**
+Provides linear allocation of memory that's released all at once when reset() is called
+    @note The block isn't allocated until the first call to allocate(), FrameAllocators that are never used don't reserve any memory
+    @note Allocations that don't fit in the current block are served from overflow blocks, on reset() the block grows to the high water mark so steady state frames never allocate
+    @note FrameAllocator isn't thread safe
+*/
+class FrameAllocator final
+{
+public:
+    static constexpr size_t DefaultCapacity { 1024 * 1024 }; //!< The default number of bytes a FrameAllocator reserves on its first allocation
+
+    /**
+    Adapts a FrameAllocator for use with STL containers
+        @note deallocate() is a no-op, memory is reclaimed when the FrameAllocator is reset
+    */
+    template <typename T>
+    class Allocator
+    {
+    public:
+        using value_type = T; //!< The type of object allocated
+
+        /**
+        Constructs an instance of Allocator
+        @param [in] frameAllocator The FrameAllocator to allocate from
+        */
+        inline Allocator(FrameAllocator& frameAllocator) noexcept
+            : mpFrameAllocator { &frameAllocator }
+        {
+        }
+
+        /**
+        Constructs an instance of Allocator from an Allocator of another type
+        @param [in] other The Allocator to copy the FrameAllocator from
+        */
+        template <typename U>
+        inline Allocator(const Allocator<U>& other) noexcept
+            : mpFrameAllocator { other.mpFrameAllocator }
+        {
+        }
+
+        /**
+        Allocates storage for a given number of objects
+        @param [in] count The number of objects to allocate storage for
+        @return A pointer to the allocated storage
+        */
+        inline T* allocate(size_t count)
+        {
+            return (T*)mpFrameAllocator->allocate(count * sizeof(T), alignof(T));
+        }
+
+        /**
+        Deallocates storage, this is a no-op
+        */
+        inline void deallocate(T*, size_t) noexcept
+        {
+        }
+
+        /**
+        Gets a value indicating whether or not two Allocators allocate from the same FrameAllocator
+        */
+        template <typename U>
+        inline bool operator==(const Allocator<U>& other) const noexcept
+        {
+            return mpFrameAllocator == other.mpFrameAllocator;
+        }
+
+        /**
+        Gets a value indicating whether or not two Allocators allocate from different FrameAllocators
+        */
+        template <typename U>
+        inline bool operator!=(const Allocator<U>& other) const noexcept
+        {
+            return !(*this == other);
+        }
+
+    private:
+        template <typename U>
+        friend class Allocator;
+        FrameAllocator* mpFrameAllocator { nullptr };
+    };
+
+    /**
+    Constructs an instance of FrameAllocator
+    @param [in] capacity (optional = DefaultCapacity) The number of bytes to reserve on the first call to allocate()
+    */
+    FrameAllocator(size_t capacity = DefaultCapacity);
+
+    /**
+    Moves an instance of FrameAllocator
+    @param [in] other The FrameAllocator to move from
+    */
+    FrameAllocator(FrameAllocator&& other) noexcept;
+
+    /**
+    Moves an instance of FrameAllocator
+        @note Allocations made from this FrameAllocator are released
+    @param [in] other The FrameAllocator to move from
+    @return A reference to this FrameAllocator
+    */
+    FrameAllocator& operator=(FrameAllocator&& other) noexcept;
+
+    /**
+    Allocates a given number of bytes
+        @note Throws std::bad_alloc if an overflow block can't be allocated
+    @param [in] size The number of bytes to allocate
+    @param [in] alignment (optional = alignof(std::max_align_t)) The alignment of the allocation, must be a power of 2
+    @return A pointer to the allocated bytes, valid until reset() is called
+    */
+    void* allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+    /**
+    Constructs an object in memory allocated from this FrameAllocator
+        @note The object's destructor isn't called by reset()
+    @param [in] args The arguments to forward to the object's constructor
+    @return A pointer to the constructed object
+    */
+    template <typename T, typename ...Args>
+    inline T* create(Args&&... args)
+    {
+        return new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+    }
+
+    /**
+    Gets an Allocator that allocates from this FrameAllocator
+    @return An Allocator that allocates from this FrameAllocator
+    */
+    template <typename T = std::byte>
+    inline Allocator<T> get_allocator()
+    {
+        return Allocator<T>(*this);
+    }
+
+    /**
+    Releases every allocation made since the last call to reset()
+        @note If overflow blocks were needed this FrameAllocator's block grows to the high water mark plus the largest alignment requested
+    */
+    void reset();
+
+    /**
+    Gets the number of bytes this FrameAllocator's block can hold
+        @note The block may not have been allocated yet
+    @return The number of bytes this FrameAllocator's block can hold
+    */
+    size_t get_capacity() const;
+
+    /**
+    Gets the number of bytes allocated since the last call to reset()
+    @return The number of bytes allocated since the last call to reset(), including alignment padding
+    */
+    size_t get_size() const;
+
+    /**
+    Gets the largest number of bytes allocated between calls to reset()
+    @return The largest number of bytes allocated between calls to reset()
+    */
+    size_t get_high_water_mark() const;
+
+    /**
+    Gets the number of overflow blocks allocated
+    @return The number of overflow blocks allocated since this FrameAllocator was created
+    */
+    size_t get_overflow_count() const;
+
+private:
+    std::unique_ptr<std::byte[]> mBlock;
+    size_t mCapacity { 0 };
+    std::vector<std::unique_ptr<std::byte[]>> mOverflowBlocks;
+    std::byte* mpCurrentBlock { nullptr };
+    size_t mCurrentBlockCapacity { 0 };
+    size_t mCurrentBlockOffset { 0 };
+    size_t mSize { 0 };
+    size_t mHighWaterMark { 0 };
+    size_t mOverflowCount { 0 };
+    size_t mMaxAlignment { 0 };
+};
+
+} // namespace sys
+} // namespace dst
@@ -0,0 +1,160 @@
+
+/*
+==========================================
+  Copyright (c) 2020 Dynamic_Static
+    Patrick Purcell
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#pragma once
+
+#include "dynamic_static/core/enum.hpp"
+#include "dynamic_static/core/time.hpp"
+#include "dynamic_static/system/defines.hpp"
+#include "dynamic_static/system/input.hpp"
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace dst {
+namespace sys {
+
+/**
+Runs fixed timestep simulation ticks decoupled from the render rate
+    @note Each call to update() runs as many ticks as real time requires and returns an interpolation alpha for rendering between the two most recent ticks
+    @note The first tick of a frame receives that frame's Input, later ticks in the same frame receive the same state without presses, releases, or motion so edges aren't counted twice
+    @note Frames that don't run a tick are folded into the Input received by the next tick with Input::accumulate(), Input should be consumed in the TickFunction so no edges are lost
+    @note Later ticks and threaded ticks receive an Input::snapshot() rather than a copy of the entire Input, their InputHistory only contains the ticks run since the snapshot
+*/
+class FrameLoop final
+{
+public:
+    /**
+    The function called for each tick
+    @param [in] tickTime The number of seconds simulated by each tick
+    @param [in] input The Input snapshot for the tick
+    */
+    using TickFunction = std::function<void(double tickTime, const Input& input)>;
+
+    /**
+    Configuration parameters for FrameLoop construction
+    */
+    struct Info final
+    {
+        /**
+        Specifies FrameLoop options
+        */
+        enum class Flags
+        {
+            Threaded = 1, //!< Ticks run on a worker thread, see wait()
+            Default  = 0, //!< The default Flags
+        };
+
+        Flags flags { Flags::Default };   //!< This FrameLoop object's Flags
+        double tickTime { 1.0 / 60.0 };   //!< The number of seconds simulated by each tick
+        uint32_t maxTicksPerFrame { 8 };  //!< The maximum number of ticks run per frame, time beyond this is dropped so a slow frame doesn't cascade into slower frames
+    };
+
+    /**
+    Constructs an instance of FrameLoop
+    @param [in] info This FrameLoop object's FrameLoop::Info
+    @param [in] tickFunction The TickFunction to call for each tick
+    */
+    FrameLoop(const Info& info, TickFunction tickFunction);
+
+    /**
+    Destroys this instance of FrameLoop
+        @note Waits for in flight ticks to complete
+    */
+    ~FrameLoop();
+
+    FrameLoop(const FrameLoop&) = delete;
+    FrameLoop& operator=(const FrameLoop&) = delete;
+
+    /**
+    Gets this FrameLoop object's FrameLoop::Info
+    @return This FrameLoop object's FrameLoop::Info
+    */
+    const Info& get_info() const;
+
+    /**
+    Runs the ticks owed for the real time elapsed since the previous call to update()
+        @note The first call to update() doesn't run any ticks
+        @note If Info::Flags::Threaded is set this method waits for the previous frame's ticks then hands this frame's ticks to the worker thread and returns immediately
+    @param [in] input The Input snapshot to hand to this frame's ticks
+    @return The interpolation alpha in the range [0, 1) between the two most recent ticks
+    */
+    double update(const Input& input);
+
+    /**
+    Runs the ticks owed for a given elapsed time
+        @note Passing a fixed elapsed time makes the number of ticks run deterministic, which is useful when replaying Input
+    @param [in] input The Input snapshot to hand to this frame's ticks
+    @param [in] elapsedTime The number of seconds to advance the simulation by
+    @return The interpolation alpha in the range [0, 1) between the two most recent ticks
+    */
+    double update(const Input& input, double elapsedTime);
+
+    /**
+    Waits for in flight ticks to complete
+        @note When Info::Flags::Threaded is set simulation state must only be read between wait() and the next call to update(), rendered state lags simulation by one frame
+        @note If a tick threw an exception it's rethrown here
+    */
+    void wait();
+
+    /**
+    Gets the interpolation alpha returned by the most recent call to update()
+    @return The interpolation alpha returned by the most recent call to update()
+    */
+    double get_alpha() const;
+
+    /**
+    Gets the number of ticks run since this FrameLoop was created
+        @note When Info::Flags::Threaded is set this count includes ticks that are still in flight
+    @return The number of ticks run since this FrameLoop was created
+    */
+    uint64_t get_tick_count() const;
+
+    /**
+    Gets the number of ticks dropped because a frame exceeded Info::maxTicksPerFrame
+    @return The number of ticks dropped since this FrameLoop was created
+    */
+    uint64_t get_dropped_tick_count() const;
+
+private:
+    void run_ticks(const Input& input, uint32_t tickCount);
+    void process_ticks();
+
+    Info mInfo { };
+    TickFunction mTickFunction;
+    double mAccumulator { 0 };
+    double mAlpha { 0 };
+    uint64_t mTickCount { 0 };
+    uint64_t mDroppedTickCount { 0 };
+    bool mStarted { false };
+    bool mInputCarried { false };
+    dst::TimePoint<> mPreviousTimePoint { };
+    Input mInput { };
+    std::thread mThread;
+    std::mutex mMutex;
+    std::condition_variable mConditionVariable;
+    uint32_t mPendingTickCount { 0 };
+    bool mBusy { false };
+    bool mStop { false };
+    std::exception_ptr mException;
+};
+
+} // namespace sys
+
+template <>
+struct EnumClassOperators<sys::FrameLoop::Info::Flags>
+{
+    static constexpr bool enabled { true };
+};
+
+} // namespace dst
@@ -0,0 +1,68 @@
+
+/*
+==========================================
+  Copyright (c) 2020 Dynamic_Static
+    Patrick Purcell
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#pragma once
+
+#include "dynamic_static/core/time.hpp"
+#include "dynamic_static/system/defines.hpp"
+
+namespace dst {
+namespace sys {
+
+/**
+Paces a loop to a target frame time by sleeping until each frame's deadline
+    @note The FramePacer sleeps until shortly before each deadline then yields for the remainder, the margin reserved for yielding adapts to the oversleep observed on the current platform
+    @note The margin is capped at MaxSleepMargin so a coarse system timer costs accuracy rather than a busy wait, on Windows the system timer resolution is raised to 1 millisecond while pacing
+*/
+class FramePacer final
+{
+public:
+    static constexpr double MaxSleepMargin { 0.002 }; //!< The maximum number of seconds a FramePacer yields rather than sleeps before each deadline
+
+    /**
+    Constructs an instance of FramePacer
+    @param [in] targetFrameTime (optional = 0) The number of seconds to target per frame, 0 disables pacing
+    */
+    FramePacer(double targetFrameTime = 0);
+
+    /**
+    Gets this FramePacer object's target frame time
+    @return This FramePacer object's target frame time in seconds
+    */
+    double get_target_frame_time() const;
+
+    /**
+    Sets this FramePacer object's target frame time
+        @note Setting the target frame time resets this FramePacer
+    @param [in] targetFrameTime The number of seconds to target per frame, 0 disables pacing
+    */
+    void set_target_frame_time(double targetFrameTime);
+
+    /**
+    Blocks until this FramePacer object's next deadline
+        @note If the deadline has already passed this FramePacer resynchronizes to the current time rather than hurrying subsequent frames
+    */
+    void wait();
+
+    /**
+    Resets this FramePacer, the next call to wait() won't block
+    */
+    void reset();
+
+private:
+    double mTargetFrameTime { 0 };
+    double mOversleepMean { 0.0005 };
+    double mOversleepDeviation { 0.00025 };
+    double mSleepMargin { 0.001 };
+    dst::TimePoint<> mDeadline { };
+};
+
+} // namespace sys
+} // namespace dst
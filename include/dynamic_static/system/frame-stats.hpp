@@ -0,0 +1,196 @@
+
+/*
+==========================================
+  Copyright (c) 2020 Dynamic_Static
+    Patrick Purcell
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#pragma once
+
+#include "dynamic_static/core/time.hpp"
+#include "dynamic_static/system/defines.hpp"
+
+#include <array>
+
+namespace dst {
+namespace sys {
+
+/**
+Records per frame CPU timings for a rolling window of frames
+    @note FrameStats never allocates, samples are stored in fixed capacity rings
+*/
+class FrameStats final
+{
+public:
+    /**
+    Specifies a phase of a frame
+    */
+    enum class Phase
+    {
+        PollEvents, //!< Time spent in Window::poll_events() or Window::wait_events()
+        Update,     //!< Time spent in user update
+        Draw,       //!< Time spent in user draw
+        Swap,       //!< Time spent in Window::swap(), including frame pacing
+        Frame,      //!< Time between calls to FrameStats::end_frame()
+        Count,      //!< The number of Phases
+    };
+
+    /**
+    Summarizes the samples recorded for a Phase
+        @note All values are in seconds
+    */
+    struct Summary final
+    {
+        double p50 { 0 };       //!< The 50th percentile sample
+        double p95 { 0 };       //!< The 95th percentile sample
+        double p99 { 0 };       //!< The 99th percentile sample
+        double max { 0 };       //!< The largest sample
+        size_t sampleCount { }; //!< The number of samples summarized
+    };
+
+    /**
+    Records the time spent in a Phase for the lifetime of a ScopedPhase
+    */
+    class ScopedPhase final
+    {
+    public:
+        /**
+        Constructs an instance of ScopedPhase
+        @param [in] frameStats The FrameStats to record to
+        @param [in] phase The Phase to record
+        */
+        ScopedPhase(FrameStats& frameStats, Phase phase);
+
+        /**
+        Destroys this instance of ScopedPhase, recording the time since it was constructed
+        */
+        ~ScopedPhase();
+
+    private:
+        FrameStats& mFrameStats;
+        Phase mPhase { };
+        dst::TimePoint<> mBegin { };
+        ScopedPhase(const ScopedPhase&) = delete;
+        ScopedPhase& operator=(const ScopedPhase&) = delete;
+    };
+
+    static constexpr size_t SampleCapacity { 256 }; //!< The number of frames FrameStats retains
+
+    /**
+    Constructs an instance of FrameStats
+    @param [in] hitchThreshold (optional = 0) The frame time in seconds beyond which a frame is counted as a hitch, 0 uses twice the median frame time
+    */
+    FrameStats(double hitchThreshold = 0);
+
+    /**
+    Gets this FrameStats object's hitch threshold
+    @return This FrameStats object's hitch threshold in seconds
+    */
+    double get_hitch_threshold() const;
+
+    /**
+    Sets this FrameStats object's hitch threshold
+    @param [in] hitchThreshold The frame time in seconds beyond which a frame is counted as a hitch, 0 uses twice the median frame time
+    */
+    void set_hitch_threshold(double hitchThreshold);
+
+    /**
+    Gets the number of hitches counted since this FrameStats was last reset
+    @return The number of hitches counted since this FrameStats was last reset
+    */
+    uint64_t get_hitch_count() const;
+
+    /**
+    Gets the number of frames ended since this FrameStats was last reset
+    @return The number of frames ended since this FrameStats was last reset
+    */
+    uint64_t get_frame_count() const;
+
+    /**
+    Gets the time spent in a given Phase during the most recently ended frame
+    @param [in] phase The Phase to get the time spent in
+    @return The time spent in the given Phase during the most recently ended frame in seconds
+    */
+    double get_last(Phase phase) const;
+
+    /**
+    Gets a Summary of the samples retained for a given Phase
+        @note This method is O(SampleCapacity)
+    @param [in] phase The Phase to get the Summary of
+    @return The Summary of the samples retained for the given Phase
+    */
+    Summary get_summary(Phase phase) const;
+
+    /**
+    Gets the number of heap allocations recorded for the most recently ended frame
+    @return The number of heap allocations recorded for the most recently ended frame
+    */
+    uint64_t get_last_allocation_count() const;
+
+    /**
+    Gets the number of heap bytes allocated recorded for the most recently ended frame
+    @return The number of heap bytes allocated recorded for the most recently ended frame
+    */
+    uint64_t get_last_allocated_bytes() const;
+
+    /**
+    Gets the largest number of heap allocations recorded for a single frame since this FrameStats was last reset
+    @return The largest number of heap allocations recorded for a single frame since this FrameStats was last reset
+    */
+    uint64_t get_max_allocation_count() const;
+
+    /**
+    Adds time spent in a given Phase to the current frame
+        @note Multiple records for the same Phase in a single frame are accumulated
+    @param [in] phase The Phase to add time to
+    @param [in] seconds The number of seconds to add
+    */
+    void record(Phase phase, double seconds);
+
+    /**
+    Adds heap allocations to the current frame
+        @note end_frame() records the allocations made since the previous frame ended when dynamic_static.system is built with DST_SYS_TRACK_ALLOCATIONS, see AllocationTracker
+    @param [in] allocationCount The number of allocations to add
+    @param [in] allocatedBytes The number of bytes allocated to add
+    */
+    void record_allocations(uint64_t allocationCount, uint64_t allocatedBytes);
+
+    /**
+    Ends the current frame, committing its Phase timings and counting a hitch if its frame time exceeds the hitch threshold
+        @note The Frame Phase is measured automatically and shouldn't be recorded manually
+        @note Heap allocations made since the previous frame ended are recorded to the frame being ended, see AllocationTracker
+    */
+    void end_frame();
+
+    /**
+    Resets this FrameStats, discarding all samples and counts
+    */
+    void reset();
+
+private:
+    using Samples = std::array<double, SampleCapacity>;
+    size_t get_last_sample_index() const;
+
+    std::array<Samples, (size_t)Phase::Count> mSamples { };
+    std::array<double, (size_t)Phase::Count> mCurrent { };
+    mutable Samples mScratch { };
+    size_t mSampleBegin { 0 };
+    size_t mSampleCount { 0 };
+    double mHitchThreshold { 0 };
+    uint64_t mHitchCount { 0 };
+    uint64_t mFrameCount { 0 };
+    uint64_t mCurrentAllocationCount { 0 };
+    uint64_t mCurrentAllocatedBytes { 0 };
+    uint64_t mLastAllocationCount { 0 };
+    uint64_t mLastAllocatedBytes { 0 };
+    uint64_t mMaxAllocationCount { 0 };
+    uint64_t mTrackedAllocationCount { 0 };
+    uint64_t mTrackedAllocatedBytes { 0 };
+    dst::TimePoint<> mFrameBegin { };
+};
+
+} // namespace sys
+} // namespace dst
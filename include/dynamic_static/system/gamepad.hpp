@@ -10,15 +10,287 @@
 
 #pragma once
 
+#include "dynamic_static/system/bit-set.hpp"
 #include "dynamic_static/system/defines.hpp"
 
-#include <bitset>
+#include <array>
 
 namespace dst {
 namespace sys {
 
+/**
+Provides high level control over gamepad queries for every connected gamepad
+    @note Gamepads are identified by index, state is stored as structures of arrays so each Axis and Gamepad::Button is contiguous across gamepads
+*/
 struct Gamepad final
 {
+    static constexpr size_t Capacity { 16 }; //!< The maximum number of gamepads
+
+    /**
+    Enumerates gamepad buttons
+        @note Gamepad::Buttons use the Xbox layout and match the order of GLFW's gamepad buttons
+    */
+    enum class Button
+    {
+        A,
+        B,
+        X,
+        Y,
+        LeftBumper,
+        RightBumper,
+        Back,
+        Start,
+        Guide,
+        LeftThumb,
+        RightThumb,
+        DpadUp,
+        DpadRight,
+        DpadDown,
+        DpadLeft,
+
+        Count,
+    };
+
+    /**
+    Enumerates gamepad axes
+        @note Axes match the order of GLFW's gamepad axes, sticks range from -1 to 1 and triggers range from 0 to 1
+    */
+    enum class Axis
+    {
+        LeftX,
+        LeftY,
+        RightX,
+        RightY,
+        LeftTrigger,
+        RightTrigger,
+
+        Count,
+    };
+
+    /**
+    Represents the Gamepad::Buttons of every gamepad, indexed by get_bit_index()
+    */
+    using Buttons = BitSet<(int)Button::Count * Capacity>;
+
+    /**
+    Represents a Gamepad object's state at a single moment
+    */
+    struct State final
+    {
+        alignas(64) std::array<std::array<float, Capacity>, (int)Axis::Count> axes { }; //!< This Gamepad::State object's Axis values, indexed by Axis then gamepad
+        Buttons buttons { };                                                            //!< This Gamepad::State object's Gamepad::Button state
+        BitSet<Capacity> connected { };                                                 //!< The gamepads that are connected
+
+        /**
+        Resets this Gamepad::State
+        */
+        void reset();
+    };
+
+    /**
+    Specifies how raw Axis values are mapped to processed Axis values
+    */
+    struct Response final
+    {
+        float deadzone { 0.2f };    //!< Magnitudes at or below this value are mapped to 0, stick magnitudes are radial
+        float saturation { 0.95f }; //!< Magnitudes at or above this value are mapped to 1
+        float curve { 0 };          //!< Blends the mapping from linear at 0 to cubic at 1 for finer control near the deadzone
+    };
+
+    /**
+    Provides raw Gamepad::State for every gamepad
+        @note Window polls its Gamepad::Source once per call to Window::poll_events() or Window::wait_events()
+    */
+    class Source
+    {
+    public:
+        /**
+        Destroys this instance of Gamepad::Source
+        */
+        virtual ~Source() = default;
+
+        /**
+        Populates a given Gamepad::State with the raw state of every gamepad
+            @note Axes of disconnected gamepads must be 0 and their Gamepad::Buttons must be up
+        @param [out] pState The Gamepad::State to populate
+        */
+        virtual void poll(State* pState) = 0;
+    };
+
+    /**
+    Provides Gamepad::State that's set programmatically rather than read from devices
+    */
+    class VirtualSource final
+        : public Source
+    {
+    public:
+        /**
+        Sets whether or not a given gamepad is connected
+            @note Disconnecting a gamepad clears its Axis values and Gamepad::Buttons
+        @param [in] index The index of the gamepad to set
+        @param [in] connected Whether or not the given gamepad is connected
+        */
+        void set_connected(size_t index, bool connected);
+
+        /**
+        Sets the state of a given Gamepad::Button
+        @param [in] index The index of the gamepad to set
+        @param [in] button The Gamepad::Button to set
+        @param [in] down Whether or not the given Gamepad::Button is down
+        */
+        void set(size_t index, Button button, bool down);
+
+        /**
+        Sets the raw value of a given Axis
+        @param [in] index The index of the gamepad to set
+        @param [in] axis The Axis to set
+        @param [in] value The raw value to set
+        */
+        void set(size_t index, Axis axis, float value);
+
+        /**
+        Populates a given Gamepad::State with this Gamepad::VirtualSource object's state
+        @param [out] pState The Gamepad::State to populate
+        */
+        void poll(State* pState) override final;
+
+    private:
+        State mState { };
+    };
+
+    /**
+    Gets the index of the bit that represents a given Gamepad::Button in Gamepad::Buttons
+    @param [in] index The index of the gamepad
+    @param [in] button The Gamepad::Button
+    @return The index of the bit that represents the given Gamepad::Button
+    */
+    static size_t get_bit_index(size_t index, Button button);
+
+    /**
+    Maps the raw Axis values in a given Gamepad::State to processed values
+        @note Sticks get a radial deadzone so diagonals aren't snapped to an axis, triggers get an axial deadzone
+        @note Every gamepad is processed in a single pass over each Axis, the loops are written to be vectorized by the compiler
+    @param [in] stickResponse The Response to apply to stick Axis values
+    @param [in] triggerResponse The Response to apply to trigger Axis values
+    @param [in,out] pState The Gamepad::State to process
+    */
+    static void process(const Response& stickResponse, const Response& triggerResponse, State* pState);
+
+    /**
+    Gets a value indicating whether or not a given gamepad is connected
+    @param [in] index The index of the gamepad to check
+    @return Whether or not the given gamepad is connected
+    */
+    bool connected(size_t index) const;
+
+    /**
+    Gets a value indicating whether or not a given Gamepad::Button is up
+    @param [in] index The index of the gamepad to check
+    @param [in] button The Gamepad::Button to check
+    @return Whether or not the given Gamepad::Button is up
+    */
+    bool up(size_t index, Button button) const;
+
+    /**
+    Gets a value indicating whether or not a given Gamepad::Button is down
+    @param [in] index The index of the gamepad to check
+    @param [in] button The Gamepad::Button to check
+    @return Whether or not the given Gamepad::Button is down
+    */
+    bool down(size_t index, Button button) const;
+
+    /**
+    Gets a value indicating whether or not a given Gamepad::Button has been held
+    @param [in] index The index of the gamepad to check
+    @param [in] button The Gamepad::Button to check
+    @return Whether or not the given Gamepad::Button has been held
+    */
+    bool held(size_t index, Button button) const;
+
+    /**
+    Gets a value indicating whether or not a given Gamepad::Button has been pressed
+    @param [in] index The index of the gamepad to check
+    @param [in] button The Gamepad::Button to check
+    @return Whether or not the given Gamepad::Button has been pressed
+    */
+    bool pressed(size_t index, Button button) const;
+
+    /**
+    Gets a value indicating whether or not a given Gamepad::Button has been released
+    @param [in] index The index of the gamepad to check
+    @param [in] button The Gamepad::Button to check
+    @return Whether or not the given Gamepad::Button has been released
+    */
+    bool released(size_t index, Button button) const;
+
+    /**
+    Gets the processed value of a given Axis
+    @param [in] index The index of the gamepad to check
+    @param [in] axis The Axis to get the value of
+    @return The processed value of the given Axis
+    */
+    float axis(size_t index, Axis axis) const;
+
+    /**
+    Gets the Gamepad::Buttons that are down
+    @return The Gamepad::Buttons that are down, indexed by get_bit_index()
+    */
+    const Buttons& down_buttons() const;
+
+    /**
+    Gets the Gamepad::Buttons that have been pressed
+    @return The Gamepad::Buttons that have been pressed, indexed by get_bit_index()
+    */
+    Buttons pressed_buttons() const;
+
+    /**
+    Gets the Gamepad::Buttons that have been released
+    @return The Gamepad::Buttons that have been released, indexed by get_bit_index()
+    */
+    Buttons released_buttons() const;
+
+    /**
+    Stages whether or not a given gamepad is connected
+    @param [in] index The index of the gamepad to stage
+    @param [in] connected Whether or not the given gamepad is connected
+    */
+    void stage_connection(size_t index, bool connected);
+
+    /**
+    Stages the state of a given Gamepad::Button
+    @param [in] index The index of the gamepad to stage
+    @param [in] button The Gamepad::Button to stage
+    @param [in] down Whether or not the given Gamepad::Button is down
+    */
+    void stage(size_t index, Button button, bool down);
+
+    /**
+    Stages the processed value of a given Axis
+    @param [in] index The index of the gamepad to stage
+    @param [in] axis The Axis to stage
+    @param [in] value The processed value to stage
+    */
+    void stage(size_t index, Axis axis, float value);
+
+    /**
+    Updates this Gamepad with its staged state
+        @note This method must be called periodically to keep this Gamepad up to date
+    */
+    void update();
+
+    /**
+    Resets this Gamepad
+    */
+    void reset();
+
+    State previous { }; //!< This Gamepad object's previous State
+    State current { };  //!< This Gamepad object's current State
+
+    /**
+    This Gamepad object's staged State
+        @note This State will be applied when update() is called
+    */
+    State staged { };
 };
 
 } // namespace sys
@@ -0,0 +1,175 @@
+
+/*
+==========================================
+  Copyright (c) 2020 Dynamic_Static
+    Patrick Purcell
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#pragma once
+
+#include "dynamic_static/core/math.hpp"
+#include "dynamic_static/core/time.hpp"
+#include "dynamic_static/system/bit-set.hpp"
+#include "dynamic_static/system/defines.hpp"
+#include "dynamic_static/system/gamepad.hpp"
+#include "dynamic_static/system/keyboard.hpp"
+#include "dynamic_static/system/mouse.hpp"
+
+#include <array>
+
+namespace dst {
+namespace sys {
+
+/**
+Records the Keyboard, Mouse, and Gamepad::Button state of the most recent frames in a fixed size ring
+    @note advance() writes a single compact Frame per call, double tap queries scan back over at most Capacity Frames
+    @note Press timestamps are tracked separately from the ring so held times aren't limited to the time Capacity Frames span
+*/
+class InputHistory final
+{
+public:
+    static constexpr size_t Capacity { 64 }; //!< The number of Frames an InputHistory retains, older Frames are overwritten
+
+    /**
+    Represents the Keyboard, Mouse, and Gamepad::Button state of a single frame
+    */
+    struct Frame final
+    {
+        Keyboard::State keys { };                               //!< The Keyboard::Keys that were down
+        Keyboard::State pressedKeys { };                        //!< The Keyboard::Keys that were pressed
+        Keyboard::State repressedKeys { };                      //!< The Keyboard::Keys that were pressed more than once
+        BitSet<(int)Mouse::Button::Count> buttons { };          //!< The Mouse::Buttons that were down
+        BitSet<(int)Mouse::Button::Count> pressedButtons { };   //!< The Mouse::Buttons that were pressed
+        BitSet<(int)Mouse::Button::Count> repressedButtons { }; //!< The Mouse::Buttons that were pressed more than once
+        Gamepad::Buttons gamepadButtons { };                    //!< The Gamepad::Buttons that were down
+        Gamepad::Buttons pressedGamepadButtons { };             //!< The Gamepad::Buttons that were pressed
+        glm::vec2 position { };                                 //!< The Mouse position
+        glm::dvec2 motion { };                                  //!< The Mouse motion accumulated during the frame
+        float scroll { };                                       //!< The Mouse scroll value
+        dst::TimePoint<> timestamp { };                         //!< The moment the frame was recorded
+    };
+
+    /**
+    Records a Frame from a given Keyboard, Mouse, and Gamepad, overwriting the oldest Frame if this InputHistory is full
+    @param [in] keyboard The Keyboard to record
+    @param [in] mouse The Mouse to record
+    @param [in] gamepad The Gamepad to record
+    @param [in] timestamp The moment the Frame is recorded
+    */
+    void advance(const Keyboard& keyboard, const Mouse& mouse, const Gamepad& gamepad, dst::TimePoint<> timestamp);
+
+    /**
+    Discards a given number of the most recent Frames
+        @note If an input was released and pressed again in the discarded Frames its press timestamp is recovered from the remaining Frames, so held times can't exceed their span
+    @param [in] frameCount The number of Frames to discard
+    */
+    void rewind(size_t frameCount);
+
+    /**
+    Resets this InputHistory
+    */
+    void reset();
+
+    /**
+    Gets the number of Frames in this InputHistory
+    @return The number of Frames in this InputHistory
+    */
+    size_t size() const;
+
+    /**
+    Gets the Frame recorded a given number of frames ago
+    @param [in] age The number of frames ago the Frame was recorded, 0 is the most recent Frame
+    @return The Frame recorded the given number of frames ago
+    */
+    const Frame& get_frame(size_t age) const;
+
+    /**
+    Gets a value indicating whether or not a given Keyboard::Key was pressed in the most recent Frame after being pressed within a given interval
+    @param [in] key The Keyboard::Key to check
+    @param [in] interval The maximum number of seconds between presses
+    @return Whether or not the given Keyboard::Key has been double tapped
+    */
+    bool double_tapped(Keyboard::Key key, double interval) const;
+
+    /**
+    Gets a value indicating whether or not a given Mouse::Button was pressed in the most recent Frame after being pressed within a given interval
+    @param [in] button The Mouse::Button to check
+    @param [in] interval The maximum number of seconds between presses
+    @return Whether or not the given Mouse::Button has been double tapped
+    */
+    bool double_tapped(Mouse::Button button, double interval) const;
+
+    /**
+    Gets a value indicating whether or not a given Gamepad::Button was pressed in the most recent Frame after being pressed within a given interval
+    @param [in] index The index of the gamepad to check
+    @param [in] button The Gamepad::Button to check
+    @param [in] interval The maximum number of seconds between presses
+    @return Whether or not the given Gamepad::Button has been double tapped
+    */
+    bool double_tapped(size_t index, Gamepad::Button button, double interval) const;
+
+    /**
+    Gets the number of seconds a given Keyboard::Key has been down
+    @param [in] key The Keyboard::Key to check
+    @return The number of seconds the given Keyboard::Key has been down, 0 if it's up
+    */
+    double get_held_time(Keyboard::Key key) const;
+
+    /**
+    Gets the number of seconds a given Mouse::Button has been down
+    @param [in] button The Mouse::Button to check
+    @return The number of seconds the given Mouse::Button has been down, 0 if it's up
+    */
+    double get_held_time(Mouse::Button button) const;
+
+    /**
+    Gets the number of seconds a given Gamepad::Button has been down
+    @param [in] index The index of the gamepad to check
+    @param [in] button The Gamepad::Button to check
+    @return The number of seconds the given Gamepad::Button has been down, 0 if it's up
+    */
+    double get_held_time(size_t index, Gamepad::Button button) const;
+
+    /**
+    Gets a value indicating whether or not a given Keyboard::Key reached a given held time in the most recent Frame
+        @note This method returns true for a single Frame per press
+    @param [in] key The Keyboard::Key to check
+    @param [in] duration The number of seconds the Keyboard::Key must be held
+    @return Whether or not the given Keyboard::Key has been long pressed
+    */
+    bool long_pressed(Keyboard::Key key, double duration) const;
+
+    /**
+    Gets a value indicating whether or not a given Mouse::Button reached a given held time in the most recent Frame
+        @note This method returns true for a single Frame per press
+    @param [in] button The Mouse::Button to check
+    @param [in] duration The number of seconds the Mouse::Button must be held
+    @return Whether or not the given Mouse::Button has been long pressed
+    */
+    bool long_pressed(Mouse::Button button, double duration) const;
+
+    /**
+    Gets a value indicating whether or not a given Gamepad::Button reached a given held time in the most recent Frame
+        @note This method returns true for a single Frame per press
+    @param [in] index The index of the gamepad to check
+    @param [in] button The Gamepad::Button to check
+    @param [in] duration The number of seconds the Gamepad::Button must be held
+    @return Whether or not the given Gamepad::Button has been long pressed
+    */
+    bool long_pressed(size_t index, Gamepad::Button button, double duration) const;
+
+private:
+    static_assert(!(Capacity & (Capacity - 1)), "InputHistory::Capacity must be a power of 2");
+    std::array<Frame, Capacity> mFrames { };
+    size_t mNewest { Capacity - 1 };
+    size_t mSize { 0 };
+    std::array<dst::TimePoint<>, (int)Keyboard::Key::Count> mKeyPressTimestamps { };
+    std::array<dst::TimePoint<>, (int)Mouse::Button::Count> mButtonPressTimestamps { };
+    std::array<dst::TimePoint<>, (int)Gamepad::Button::Count * Gamepad::Capacity> mGamepadButtonPressTimestamps { };
+};
+
+} // namespace sys
+} // namespace dst
@@ -0,0 +1,213 @@
+
+/*
+==========================================
+  Copyright (c) 2020 Dynamic_Static
+    Patrick Purcell
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#pragma once
+
+#include "dynamic_static/core/enum.hpp"
+#include "dynamic_static/core/span.hpp"
+#include "dynamic_static/system/defines.hpp"
+#include "dynamic_static/system/input.hpp"
+
+#include <array>
+#include <vector>
+
+namespace dst {
+namespace sys {
+
+/**
+Maps Keyboard::Keys, Mouse::Buttons, and Mouse analog values to application defined actions and axes
+    @note Bindings are compiled into bitmask tables, update() evaluates every binding in a single pass over the tables
+    @note When a chord is active every chord that's a strict subset of it is suppressed, so binding Ctrl+S doesn't also trigger S
+*/
+class InputMap final
+{
+public:
+    /**
+    Identifies an action in an InputMap
+    */
+    using Action = uint32_t;
+
+    /**
+    Identifies an axis in an InputMap
+    */
+    using Axis = uint32_t;
+
+    /**
+    Specifies the state of an Action
+    */
+    enum class ActionState : uint8_t
+    {
+        None     = 0,      //!< The Action is inactive
+        Down     = 1,      //!< Every Keyboard::Key and Mouse::Button in at least one of the Action's chords is down
+        Pressed  = 1 << 1, //!< At least one of the Action's chords was completed since the previous call to update()
+        Released = 1 << 2, //!< The Action stopped being down since the previous call to update()
+    };
+
+    /**
+    Specifies Mouse analog values that can be bound to an Axis
+    */
+    enum class Analog
+    {
+        MouseScroll,  //!< The Mouse object's scroll delta
+        MouseMotionX, //!< The horizontal component of the Mouse object's motion delta
+        MouseMotionY, //!< The vertical component of the Mouse object's motion delta
+    };
+
+    /**
+    Adds an Action to this InputMap
+    @return The added Action
+    */
+    Action add_action();
+
+    /**
+    Binds a chord to a given Action
+        @note An Action can have any number of chords, the Action is down when any of its chords are down
+    @param [in] action The Action to bind the chord to
+    @param [in] keys The Keyboard::Keys in the chord
+    @param [in] buttons (optional = { }) The Mouse::Buttons in the chord
+    */
+    void bind_action(Action action, dst::Span<const Keyboard::Key> keys, dst::Span<const Mouse::Button> buttons = { });
+
+    /**
+    Adds an Axis to this InputMap
+    @return The added Axis
+    */
+    Axis add_axis();
+
+    /**
+    Binds a Keyboard::Key to a given Axis
+    @param [in] axis The Axis to bind the Keyboard::Key to
+    @param [in] key The Keyboard::Key to bind
+    @param [in] scale The value the Keyboard::Key adds to the Axis while it's down
+    */
+    void bind_axis(Axis axis, Keyboard::Key key, float scale);
+
+    /**
+    Binds a Mouse::Button to a given Axis
+    @param [in] axis The Axis to bind the Mouse::Button to
+    @param [in] button The Mouse::Button to bind
+    @param [in] scale The value the Mouse::Button adds to the Axis while it's down
+    */
+    void bind_axis(Axis axis, Mouse::Button button, float scale);
+
+    /**
+    Binds an Analog value to a given Axis
+    @param [in] axis The Axis to bind the Analog value to
+    @param [in] analog The Analog value to bind
+    @param [in] scale The value to scale the Analog value by before adding it to the Axis
+    */
+    void bind_axis(Axis axis, Analog analog, float scale);
+
+    /**
+    Removes all Actions, Axes, and bindings from this InputMap
+    */
+    void clear();
+
+    /**
+    Compiles this InputMap object's bindings into the tables evaluated by update()
+        @note This method is called by update() when bindings have changed since the previous compile
+    */
+    void compile();
+
+    /**
+    Evaluates every Action and Axis in this InputMap against a given Input
+        @note This method should be called once after each call to Input::update()
+    @param [in] input The Input to evaluate
+    */
+    void update(const Input& input);
+
+    /**
+    Gets a value indicating whether or not a given Action is down
+    @param [in] action The Action to check
+    @return Whether or not the given Action is down
+    */
+    bool down(Action action) const;
+
+    /**
+    Gets a value indicating whether or not a given Action has been pressed
+    @param [in] action The Action to check
+    @return Whether or not the given Action has been pressed
+    */
+    bool pressed(Action action) const;
+
+    /**
+    Gets a value indicating whether or not a given Action has been released
+    @param [in] action The Action to check
+    @return Whether or not the given Action has been released
+    */
+    bool released(Action action) const;
+
+    /**
+    Gets the value of a given Axis
+    @param [in] axis The Axis to get the value of
+    @return The value of the given Axis
+    */
+    float value(Axis axis) const;
+
+    /**
+    Gets the ActionState of every Action in this InputMap
+    @return The ActionState of every Action in this InputMap, indexed by Action
+    */
+    dst::Span<const ActionState> get_action_states() const;
+
+    /**
+    Gets the value of every Axis in this InputMap
+    @return The value of every Axis in this InputMap, indexed by Axis
+    */
+    dst::Span<const float> get_axis_values() const;
+
+private:
+    using Word = Keyboard::State::Word;
+    static constexpr size_t WordBitCount { Keyboard::State::WordBitCount };
+    static constexpr size_t KeyboardWordCount { Keyboard::State::WordCount };
+    static constexpr size_t MouseWordCount { BitSet<(int)Mouse::Button::Count>::WordCount };
+    static constexpr size_t WordCount { KeyboardWordCount + MouseWordCount };
+    using Words = std::array<Word, WordCount>;
+
+    struct ChordBinding final
+    {
+        Action action { };
+        Words mask { };
+    };
+
+    static size_t get_bit_index(Keyboard::Key key);
+    static size_t get_bit_index(Mouse::Button button);
+    static void get_words(const Keyboard::State& keys, const BitSet<(int)Mouse::Button::Count>& buttons, Words* pWords);
+
+    std::vector<ChordBinding> mChordBindings;
+    std::vector<uint32_t> mDigitalBits;
+    std::vector<Axis> mDigitalAxes;
+    std::vector<float> mDigitalScales;
+    std::vector<Analog> mAnalogs;
+    std::vector<Axis> mAnalogAxes;
+    std::vector<float> mAnalogScales;
+    bool mCompiled { false };
+    std::vector<Word> mChordMasks;
+    std::vector<Action> mChordActions;
+    std::vector<uint32_t> mSupersetOffsets;
+    std::vector<uint32_t> mSupersets;
+    std::vector<uint8_t> mChordDown;
+    std::vector<uint8_t> mChordCompleted;
+    std::vector<uint8_t> mChordPressed;
+    std::vector<uint8_t> mActionDown;
+    std::vector<uint8_t> mActionPressed;
+    std::vector<ActionState> mActionStates;
+    std::vector<float> mAxisValues;
+};
+
+} // namespace sys
+
+template <>
+struct EnumClassOperators<sys::InputMap::ActionState>
+{
+    static constexpr bool enabled { true };
+};
+
+} // namespace dst
@@ -0,0 +1,126 @@
+
+/*
+==========================================
+  Copyright (c) 2020 Dynamic_Static
+    Patrick Purcell
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#pragma once
+
+#include "dynamic_static/core/time.hpp"
+#include "dynamic_static/system/defines.hpp"
+#include "dynamic_static/system/input.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+namespace dst {
+namespace sys {
+
+/**
+Identifies and versions Input recording files
+    @note Input recording files begin with the FileMagic and FileVersion followed by a sequence of records, each record is a one byte tag followed by its payload
+    @note A tag of 0 marks the end of a frame, any other tag is an Input::Event::Type offset by one followed by the fields that Input::Event::Type uses
+    @note Values are written in native byte order, timestamps are nanoseconds since recording began
+*/
+struct InputRecording final
+{
+    static constexpr uint32_t FileMagic { 0x49545344 }; //!< "DSTI"
+    static constexpr uint32_t FileVersion { 2 };        //!< The Input recording file format version, version 2 adds gamepad Input::Event::Types
+    static constexpr uint32_t MinFileVersion { 1 };     //!< The oldest Input recording file format version that can be replayed
+};
+
+/**
+Writes Input::Events and frame boundaries to an Input recording file
+*/
+class InputRecorder final
+{
+public:
+    /**
+    Constructs an instance of InputRecorder
+    */
+    InputRecorder() = default;
+
+    /**
+    Constructs an instance of InputRecorder
+        @note Throws std::runtime_error if the file can't be opened
+    @param [in] filePath The path of the Input recording file to write
+    */
+    InputRecorder(const std::filesystem::path& filePath);
+
+    /**
+    Gets a value indicating whether or not this InputRecorder is open
+    @return Whether or not this InputRecorder is open
+    */
+    bool is_open() const;
+
+    /**
+    Writes an Input::Event to this InputRecorder
+    @param [in] event The Input::Event to write
+    */
+    void write(const Input::Event& event);
+
+    /**
+    Writes a frame boundary to this InputRecorder
+    */
+    void end_frame();
+
+    /**
+    Flushes and closes this InputRecorder
+    */
+    void close();
+
+private:
+    std::ofstream mFile;
+    dst::TimePoint<> mBegin { };
+};
+
+/**
+Reads Input::Events and frame boundaries from an Input recording file
+*/
+class InputReplayer final
+{
+public:
+    /**
+    Constructs an instance of InputReplayer
+    */
+    InputReplayer() = default;
+
+    /**
+    Constructs an instance of InputReplayer
+        @note Throws std::runtime_error if the file can't be opened or isn't a supported Input recording file
+    @param [in] filePath The path of the Input recording file to read
+    */
+    InputReplayer(const std::filesystem::path& filePath);
+
+    /**
+    Gets a value indicating whether or not this InputReplayer is open
+    @return Whether or not this InputReplayer is open
+    */
+    bool is_open() const;
+
+    /**
+    Reads the Input::Events recorded for the next frame
+        @note This InputReplayer is closed when the end of the file is reached or a malformed record is encountered
+        @note Timestamps are offset from the moment this InputReplayer was opened
+    @param [out] pEvents The std::vector to fill with the next frame's Input::Events
+    @return Whether or not a frame was read
+    */
+    bool read_frame(std::vector<Input::Event>* pEvents);
+
+    /**
+    Closes this InputReplayer
+    */
+    void close();
+
+private:
+    std::ifstream mFile;
+    dst::TimePoint<> mBegin { };
+};
+
+} // namespace sys
+} // namespace dst
@@ -10,11 +10,17 @@
 
 #pragma once
 
+#include "dynamic_static/core/math.hpp"
+#include "dynamic_static/core/span.hpp"
+#include "dynamic_static/core/time.hpp"
 #include "dynamic_static/system/defines.hpp"
 #include "dynamic_static/system/gamepad.hpp"
+#include "dynamic_static/system/input-history.hpp"
 #include "dynamic_static/system/keyboard.hpp"
 #include "dynamic_static/system/mouse.hpp"
 
+#include <array>
+
 namespace dst {
 namespace sys {
 
@@ -23,6 +29,91 @@ Provides high level control over input device queries
 */
 struct Input final
 {
+    /**
+    Represents a single timestamped input event
+    */
+    struct Event final
+    {
+        /**
+        Enumerates Input::Event types
+        */
+        enum class Type : uint8_t
+        {
+            Key,               //!< A Keyboard::Key was pressed, repeated, or released
+            MouseButton,       //!< A Mouse::Button was pressed or released
+            MousePosition,     //!< The Mouse moved, value contains its new position
+            MouseScroll,       //!< The Mouse scrolled, value contains the scroll offset
+            Text,              //!< A Unicode codepoint was input, code contains the codepoint
+            Resize,            //!< The Window was resized, value contains its new extent
+            GamepadConnection, //!< A gamepad was connected or disconnected, code contains its index, Press indicates connection and Release indicates disconnection
+            GamepadButton,     //!< A Gamepad::Button was pressed or released, code contains the gamepad index and Gamepad::Button packed by get_gamepad_code()
+            GamepadAxis,       //!< A Gamepad::Axis changed, code contains the gamepad index and Gamepad::Axis packed by get_gamepad_code(), value.x contains the processed value
+        };
+
+        /**
+        Enumerates Input::Event actions
+        */
+        enum class Action : uint8_t
+        {
+            Release, //!< A Keyboard::Key or Mouse::Button was released
+            Press,   //!< A Keyboard::Key or Mouse::Button was pressed
+            Repeat,  //!< A Keyboard::Key was held long enough to repeat
+        };
+
+        /**
+        Packs a gamepad index and a Gamepad::Button or Gamepad::Axis into an Input::Event code
+        @param [in] index The index of the gamepad
+        @param [in] element The Gamepad::Button or Gamepad::Axis
+        @return The packed Input::Event code
+        */
+        static inline uint32_t get_gamepad_code(size_t index, uint32_t element)
+        {
+            return (uint32_t)index << 16 | element;
+        }
+
+        /**
+        Gets the gamepad index packed into this Input::Event object's code
+        @return The gamepad index packed into this Input::Event object's code
+        */
+        inline size_t get_gamepad_index() const
+        {
+            return code >> 16;
+        }
+
+        /**
+        Gets the Gamepad::Button or Gamepad::Axis packed into this Input::Event object's code
+        @return The Gamepad::Button or Gamepad::Axis packed into this Input::Event object's code
+        */
+        inline uint32_t get_gamepad_element() const
+        {
+            return code & 0xffff;
+        }
+
+        Type type { };                  //!< This Input::Event object's Type
+        Action action { };              //!< This Input::Event object's Action
+        uint32_t code { };              //!< The Keyboard::Key, Mouse::Button, or codepoint this Input::Event refers to
+        glm::dvec2 value { };           //!< This Input::Event object's position, scroll offset, or extent
+        dst::TimePoint<> timestamp { }; //!< The moment this Input::Event was received
+    };
+
+    /**
+    The maximum number of Input::Events that can be staged between calls to update()
+        @note If this capacity is exceeded the oldest staged Input::Event is applied early, its state is preserved but it won't be reported by get_events()
+    */
+    static constexpr size_t EventCapacity { 256 };
+
+    /**
+    Stages an Input::Event to be applied when update() is called
+    @param [in] event The Input::Event to stage
+    */
+    void stage(const Event& event);
+
+    /**
+    Gets the Input::Events applied by the most recent call to update()
+    @return The Input::Events applied by the most recent call to update()
+    */
+    dst::Span<const Event> get_events() const;
+
     /**
     Updates this Input with its staged state
         @note This method must be called periodically to keep this Input up to date
@@ -35,16 +126,43 @@ struct Input final
     void reset();
 
     /**
-    Reverts this Input to its previous state
+    Reverts this Input to the state recorded a given number of frames ago
+        @note The reverted state reports no presses, releases, or deltas and the reverted frames are discarded from this Input object's InputHistory
+        @note If the InputHistory doesn't contain enough frames this Input is reverted to its initial state
+        @note Gamepad state isn't reverted, it continues to report the most recently polled state without presses or releases
+    @param [in] frameCount (optional = 1) The number of frames to revert
+    */
+    void revert(size_t frameCount = 1);
+
+    /**
+    Copies the Keyboard, Mouse, Gamepad, and most recently applied Input::Events of a given Input to this Input
+        @note Staged Input::Events and the InputHistory aren't copied, this Input object's InputHistory is reset
+    @param [in] input The Input to copy
+    */
+    void snapshot(const Input& input);
+
+    /**
+    Folds the most recently applied frame of a given Input into this Input so its presses, releases, scroll, and motion aren't lost
+        @note This Input must have been initialized by snapshot() from an earlier frame of the given Input, its previous state is kept while its current state is taken from the given Input
+        @note Keyboard and Mouse press and release Counts are summed, Mouse motion is summed, Gamepad state only reports the transition across every folded frame
+        @note Input::Events beyond EventCapacity are dropped from get_events(), their state is preserved
+    @param [in] input The Input to fold into this Input
     */
-    void revert();
+    void accumulate(const Input& input);
 
-    Keyboard keyboard { }; //!< This Input object's Keyboard
-    Mouse mouse { };       //!< This Input object's Mouse
+    Keyboard keyboard { };    //!< This Input object's Keyboard
+    Mouse mouse { };          //!< This Input object's Mouse
+    Gamepad gamepad { };      //!< This Input object's Gamepad
+    InputHistory history { }; //!< This Input object's InputHistory, a Frame is recorded each time update() is called
 
 private:
-    Keyboard mPreviousKeyboard;
-    Mouse mPreviousMouse;
+    void apply(const Event& event);
+
+    std::array<Event, EventCapacity> mStagedEvents { };
+    size_t mStagedEventBegin { 0 };
+    size_t mStagedEventCount { 0 };
+    std::array<Event, EventCapacity> mEvents { };
+    size_t mEventCount { 0 };
 };
 
 } // namespace sys
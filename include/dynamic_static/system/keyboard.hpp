@@ -10,9 +10,10 @@
 
 #pragma once
 
+#include "dynamic_static/system/bit-set.hpp"
 #include "dynamic_static/system/defines.hpp"
 
-#include <bitset>
+#include <array>
 
 namespace dst {
 namespace sys {
@@ -279,6 +280,51 @@ struct Keyboard final
     */
     bool released(Keyboard::Key key) const;
 
+    /**
+    Gets the number of times a given Keyboard::Key was pressed between the two most recent calls to update()
+    @param [in] key The Keyboard::Key to check
+    @return The number of times the given Keyboard::Key was pressed
+    */
+    uint32_t press_count(Keyboard::Key key) const;
+
+    /**
+    Gets the number of times a given Keyboard::Key was released between the two most recent calls to update()
+    @param [in] key The Keyboard::Key to check
+    @return The number of times the given Keyboard::Key was released
+    */
+    uint32_t release_count(Keyboard::Key key) const;
+
+    /**
+    Gets the Keyboard::Keys that are down
+    @return The Keyboard::Keys that are down, indexed by Keyboard::Key
+    */
+    const BitSet<(int)Key::Count>& down_keys() const;
+
+    /**
+    Gets the Keyboard::Keys that have been held
+    @return The Keyboard::Keys that have been held, indexed by Keyboard::Key
+    */
+    BitSet<(int)Key::Count> held_keys() const;
+
+    /**
+    Gets the Keyboard::Keys that have been pressed
+    @return The Keyboard::Keys that have been pressed, indexed by Keyboard::Key
+    */
+    BitSet<(int)Key::Count> pressed_keys() const;
+
+    /**
+    Gets the Keyboard::Keys that have been released
+    @return The Keyboard::Keys that have been released, indexed by Keyboard::Key
+    */
+    BitSet<(int)Key::Count> released_keys() const;
+
+    /**
+    Stages the state of a given Keyboard::Key, counting presses and releases
+    @param [in] key The Keyboard::Key to stage
+    @param [in] down Whether or not the given Keyboard::Key is down
+    */
+    void stage(Keyboard::Key key, bool down);
+
     /**
     Updates this Keyboard with its staged state
         @note This method must be called periodically to keep this Keyboard up to date
@@ -293,7 +339,12 @@ struct Keyboard final
     /**
     Represents a Keyboard object's state at a single moment
     */
-    using State = std::bitset<(int)Key::Count>;
+    using State = BitSet<(int)Key::Count>;
+
+    /**
+    Represents the number of times each Keyboard::Key changed state during a single frame
+    */
+    using Counts = std::array<uint8_t, (int)Key::Count>;
 
     State previous { }; //!< This Keyboard object's previous State
     State current { };  //!< This Keyboard object's current State
@@ -303,6 +354,15 @@ struct Keyboard final
         @note This State will be applied when update() is called
     */
     State staged { };
+
+    Counts pressCounts { };         //!< This Keyboard object's press Counts for the current frame
+    Counts releaseCounts { };       //!< This Keyboard object's release Counts for the current frame
+    Counts stagedPressCounts { };   //!< This Keyboard object's staged press Counts
+    Counts stagedReleaseCounts { }; //!< This Keyboard object's staged release Counts
+    State pressMask { };            //!< The Keyboard::Keys with a nonzero press Count for the current frame
+    State releaseMask { };          //!< The Keyboard::Keys with a nonzero release Count for the current frame
+    State stagedPressMask { };      //!< The Keyboard::Keys with a nonzero staged press Count
+    State stagedReleaseMask { };    //!< The Keyboard::Keys with a nonzero staged release Count
 };
 
 } // namespace sys
@@ -0,0 +1,83 @@
+
+/*
+==========================================
+  Copyright (c) 2020 Dynamic_Static
+    Patrick Purcell
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#pragma once
+
+#include "dynamic_static/core/time.hpp"
+#include "dynamic_static/system/defines.hpp"
+#include "dynamic_static/system/input.hpp"
+
+#include <array>
+
+namespace dst {
+namespace sys {
+
+/**
+Records input to present latency histograms for each Input::Event::Type
+    @note LatencyStats never allocates, histograms use fixed width buckets
+*/
+class LatencyStats final
+{
+public:
+    static constexpr size_t BucketCount { 128 };                                            //!< The number of buckets in each Histogram, the last bucket also counts latencies beyond its range
+    static constexpr double BucketWidth { 0.0005 };                                         //!< The width of each bucket in seconds
+    static constexpr size_t EventTypeCount { (size_t)Input::Event::Type::GamepadAxis + 1 }; //!< The number of Input::Event::Types with a Histogram
+
+    /**
+    Counts latency samples in fixed width buckets
+    */
+    struct Histogram final
+    {
+        /**
+        Gets the approximate latency below which a given fraction of samples fall
+            @note The returned latency is the upper bound of the bucket containing the requested percentile, clamped to max
+        @param [in] percentile The fraction of samples in the range [0, 1]
+        @return The approximate latency in seconds, or 0 if no samples have been recorded
+        */
+        double get_percentile(double percentile) const;
+
+        /**
+        Gets the mean latency
+        @return The mean latency in seconds, or 0 if no samples have been recorded
+        */
+        double get_mean() const;
+
+        std::array<uint32_t, BucketCount> buckets { }; //!< This Histogram object's bucket counts
+        uint64_t sampleCount { 0 };                    //!< The number of samples recorded
+        double min { 0 };                              //!< The smallest latency recorded in seconds
+        double max { 0 };                              //!< The largest latency recorded in seconds
+        double sum { 0 };                              //!< The sum of all latencies recorded in seconds
+    };
+
+    /**
+    Records the latency between an Input::Event being received and a given present
+    @param [in] event The Input::Event to record the latency of
+    @param [in] presentTimePoint The moment the frame that consumed the Input::Event was presented
+    */
+    void record(const Input::Event& event, dst::TimePoint<> presentTimePoint);
+
+    /**
+    Gets the Histogram for a given Input::Event::Type
+    @param [in] type The Input::Event::Type to get the Histogram for
+    @return The Histogram for the given Input::Event::Type
+    */
+    const Histogram& get_histogram(Input::Event::Type type) const;
+
+    /**
+    Resets this LatencyStats, discarding all samples
+    */
+    void reset();
+
+private:
+    std::array<Histogram, EventTypeCount> mHistograms { };
+};
+
+} // namespace sys
+} // namespace dst
@@ -11,9 +11,10 @@
 #pragma once
 
 #include "dynamic_static/core/math.hpp"
+#include "dynamic_static/system/bit-set.hpp"
 #include "dynamic_static/system/defines.hpp"
 
-#include <bitset>
+#include <array>
 
 namespace dst {
 namespace sys {
@@ -66,6 +67,13 @@ struct Mouse final
     */
     glm::vec2 position_delta() const;
 
+    /**
+    Gets the motion accumulated from every position staged between the two most recent calls to update()
+        @note Unlike position_delta(), motion is accumulated in double precision from each staged position so sub-frame motion isn't lost
+    @return The motion accumulated between the two most recent calls to update()
+    */
+    glm::dvec2 motion_delta() const;
+
     /**
     Gets a value indicating whether or not a given Mouse::Button is up
     @param [in] button The Mouse::Button to check
@@ -101,6 +109,57 @@ struct Mouse final
     */
     bool released(Mouse::Button button) const;
 
+    /**
+    Gets the number of times a given Mouse::Button was pressed between the two most recent calls to update()
+    @param [in] button The Mouse::Button to check
+    @return The number of times the given Mouse::Button was pressed
+    */
+    uint32_t press_count(Mouse::Button button) const;
+
+    /**
+    Gets the number of times a given Mouse::Button was released between the two most recent calls to update()
+    @param [in] button The Mouse::Button to check
+    @return The number of times the given Mouse::Button was released
+    */
+    uint32_t release_count(Mouse::Button button) const;
+
+    /**
+    Gets the Mouse::Buttons that are down
+    @return The Mouse::Buttons that are down, indexed by Mouse::Button
+    */
+    const BitSet<(int)Button::Count>& down_buttons() const;
+
+    /**
+    Gets the Mouse::Buttons that have been held
+    @return The Mouse::Buttons that have been held, indexed by Mouse::Button
+    */
+    BitSet<(int)Button::Count> held_buttons() const;
+
+    /**
+    Gets the Mouse::Buttons that have been pressed
+    @return The Mouse::Buttons that have been pressed, indexed by Mouse::Button
+    */
+    BitSet<(int)Button::Count> pressed_buttons() const;
+
+    /**
+    Gets the Mouse::Buttons that have been released
+    @return The Mouse::Buttons that have been released, indexed by Mouse::Button
+    */
+    BitSet<(int)Button::Count> released_buttons() const;
+
+    /**
+    Stages the state of a given Mouse::Button, counting presses and releases
+    @param [in] button The Mouse::Button to stage
+    @param [in] down Whether or not the given Mouse::Button is down
+    */
+    void stage(Mouse::Button button, bool down);
+
+    /**
+    Stages a position, accumulating the motion from the previously staged position
+    @param [in] position The position to stage
+    */
+    void stage(const glm::dvec2& position);
+
     /**
     Updates this Mouse with its staged state
         @note This method must be called periodically to keep this Mouse up to date
@@ -119,7 +178,8 @@ struct Mouse final
     {
         float scroll { };                                   //!< This Mouse::State object's scroll value
         glm::vec2 position { };                             //!< This Mouse::State object's position
-        std::bitset<(int)Mouse::Button::Count> buttons { }; //!< This Mouse::State object's Mouse::Button state
+        glm::dvec2 motion { };                              //!< This Mouse::State object's motion accumulated during a single frame
+        BitSet<(int)Mouse::Button::Count> buttons { };      //!< This Mouse::State object's Mouse::Button state
 
         /**
         Resets this Mouse::State
@@ -127,6 +187,11 @@ struct Mouse final
         void reset();
     };
 
+    /**
+    Represents the number of times each Mouse::Button changed state during a single frame
+    */
+    using Counts = std::array<uint8_t, (int)Mouse::Button::Count>;
+
     State previous { }; //!< This Mouse object's previous State
     State current { };  //!< This Mouse object's current State
 
@@ -135,6 +200,19 @@ struct Mouse final
         @note This State will be applied when update() is called
     */
     State staged { };
+
+    Counts pressCounts { };         //!< This Mouse object's press Counts for the current frame
+    Counts releaseCounts { };       //!< This Mouse object's release Counts for the current frame
+    Counts stagedPressCounts { };   //!< This Mouse object's staged press Counts
+    Counts stagedReleaseCounts { }; //!< This Mouse object's staged release Counts
+    BitSet<(int)Button::Count> pressMask { };         //!< The Mouse::Buttons with a nonzero press Count for the current frame
+    BitSet<(int)Button::Count> releaseMask { };       //!< The Mouse::Buttons with a nonzero release Count for the current frame
+    BitSet<(int)Button::Count> stagedPressMask { };   //!< The Mouse::Buttons with a nonzero staged press Count
+    BitSet<(int)Button::Count> stagedReleaseMask { }; //!< The Mouse::Buttons with a nonzero staged release Count
+
+private:
+    glm::dvec2 mStagedPosition { };
+    bool mStagedPositionValid { false };
 };
 
 } // namespace sys
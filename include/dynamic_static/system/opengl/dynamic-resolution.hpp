@@ -0,0 +1,151 @@
+
+/*
+==========================================
+  Copyright (c) 2020 Dynamic_Static
+    Patrick Purcell
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#pragma once
+
+#include "dynamic_static/system/opengl/defines.hpp"
+
+#ifdef DYNAMIC_STATIC_SYSTEM_OPENGL_ENABLED
+
+#include "dynamic_static/core/math.hpp"
+#include "dynamic_static/system/frame-stats.hpp"
+
+#include <array>
+
+namespace dst {
+namespace sys {
+namespace gl {
+
+/**
+Renders into a scaled offscreen target and upscales it to a framebuffer, adjusting the scale to keep frame time within a budget
+    @note Render targets are allocated at the maximum scale so changing the scale never reallocates them
+    @note Anything drawn after end(), like a Gui, is drawn at native resolution
+*/
+class DynamicResolution final
+{
+public:
+    static constexpr size_t QueryCount { 4 }; //!< The number of GPU timer queries a DynamicResolution cycles through
+
+    /**
+    Configuration parameters for DynamicResolution construction
+    */
+    struct Info final
+    {
+        double targetFrameTime { 1.0 / 60.0 }; //!< The number of seconds of GPU time each frame is scaled to fit
+        float minScale { 0.5f };               //!< The smallest scale applied to each axis
+        float maxScale { 1.0f };               //!< The largest scale applied to each axis
+        float adjustmentRate { 0.1f };         //!< The fraction of the difference between the current and desired scale applied each update()
+    };
+
+    /**
+    Constructs an instance of DynamicResolution with default DynamicResolution::Info
+    */
+    DynamicResolution();
+
+    /**
+    Constructs an instance of DynamicResolution
+    @param [in] info This DynamicResolution object's DynamicResolution::Info
+    */
+    DynamicResolution(const Info& info);
+
+    /**
+    Destroys this instance of DynamicResolution
+    */
+    ~DynamicResolution();
+
+    DynamicResolution(const DynamicResolution&) = delete;
+    DynamicResolution& operator=(const DynamicResolution&) = delete;
+
+    /**
+    Gets this DynamicResolution object's DynamicResolution::Info
+    @return This DynamicResolution object's DynamicResolution::Info
+    */
+    const Info& get_info() const;
+
+    /**
+    Gets this DynamicResolution object's current scale
+    @return This DynamicResolution object's current scale
+    */
+    float get_scale() const;
+
+    /**
+    Sets this DynamicResolution object's current scale
+        @note The scale is clamped to [Info::minScale, Info::maxScale] and will continue to be adjusted by update()
+    @param [in] scale The scale to set
+    */
+    void set_scale(float scale);
+
+    /**
+    Gets the extent rendered to between begin() and end()
+    @return The extent rendered to between begin() and end()
+    */
+    glm::ivec2 get_render_extent() const;
+
+    /**
+    Gets the most recently measured GPU time between begin() and end()
+        @note GPU times are read back asynchronously, the returned value lags by up to QueryCount frames
+    @return The most recently measured GPU time in seconds, or 0 if no measurement is available
+    */
+    double get_gpu_time() const;
+
+    /**
+    Adjusts this DynamicResolution object's scale from measured frame time
+        @note The most recently measured GPU time is used, the scale isn't adjusted until the first measurement is read back
+        @note If timer queries aren't supported the CPU time spent in FrameStats::Phase::Draw is used instead
+    @param [in] frameStats The FrameStats to read CPU frame time from
+    */
+    void update(const FrameStats& frameStats);
+
+    /**
+    Binds this DynamicResolution object's offscreen target and sets the viewport to get_render_extent()
+        @note The framebuffer bound when this method is called is the framebuffer end() upscales to by default
+    @param [in] extent The extent of the framebuffer that end() upscales to
+    */
+    void begin(const glm::ivec2& extent);
+
+    /**
+    Upscales this DynamicResolution object's offscreen target to the framebuffer that was bound when begin() was called and binds it
+        @note The scissor test is disabled and the viewport is reset to the extent passed to begin()
+        @note A headless Window object's framebuffer is bound when its context is made current, so it's upscaled to without passing Window::get_framebuffer()
+    */
+    void end();
+
+    /**
+    Upscales this DynamicResolution object's offscreen target to a given framebuffer and binds it
+        @note The scissor test is disabled and the viewport is reset to the extent passed to begin()
+    @param [in] framebuffer The framebuffer to upscale to
+    */
+    void end(GLuint framebuffer);
+
+private:
+    void create_render_targets(const glm::ivec2& extent);
+    void destroy_render_targets();
+
+    Info mInfo { };
+    float mScale { 1 };
+    glm::ivec2 mExtent { };
+    glm::ivec2 mRenderExtent { };
+    GLuint mFramebuffer { 0 };
+    GLuint mTargetFramebuffer { 0 };
+    GLuint mColorRenderbuffer { 0 };
+    GLuint mDepthStencilRenderbuffer { 0 };
+    std::array<GLuint, QueryCount> mQueries { };
+    std::array<bool, QueryCount> mQueriesPending { };
+    size_t mQueryIndex { 0 };
+    bool mQueryActive { false };
+    bool mTimerQueriesSupported { false };
+    double mGpuTime { 0 };
+};
+
+} // namespace gl
+} // namespace sys
+} // namespace dst
+
+#endif // DYNAMIC_STATIC_SYSTEM_OPENGL_ENABLED
@@ -32,8 +32,9 @@ class Gui final
 public:
     /**
     Constructs an instance of Gui
+    @param [in] pFontAtlas (optional = nullptr) A prebuilt ImFontAtlas to use, it must outlive this Gui
     */
-    Gui();
+    Gui(ImFontAtlas* pFontAtlas = nullptr);
 
     /**
     Destroys this instance of Gui
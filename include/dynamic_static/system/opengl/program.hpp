@@ -71,6 +71,13 @@ public:
     */
     GLint uniform_location(const std::string& uniformName) const;
 
+    /**
+    Gets the location of a uniform in this Program
+    @param [in] pUniformName The name of the uniform to get the location of
+    @return The location of the uniform, -1 if the uniform isn't active
+    */
+    GLint uniform_location(const char* pUniformName) const;
+
     /**
     TODO : Documentation
     */
@@ -0,0 +1,171 @@
+
+/*
+==========================================
+  Copyright (c) 2020 Dynamic_Static
+    Patrick Purcell
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#pragma once
+
+#include "dynamic_static/core/enum.hpp"
+#include "dynamic_static/core/math.hpp"
+#include "dynamic_static/system/defines.hpp"
+#include "dynamic_static/system/gui.hpp"
+#include "dynamic_static/system/window.hpp"
+
+#include <array>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace dst {
+namespace sys {
+
+/**
+Owns GLFW for its lifetime and prewarms startup work on a background thread
+    @note While a System exists GLFW stays initialized, so Windows can be destroyed and recreated without reinitializing it
+    @note Only one System should exist at a time, it must be created and destroyed on the main thread
+*/
+class System final
+{
+public:
+    /**
+    Enumerates System startup phases
+    */
+    enum class Phase
+    {
+        Initialization,     //!< Initializing GLFW
+        MonitorEnumeration, //!< Enumerating Monitors
+        ContextCreation,    //!< Creating the share Window and initializing the OpenGL loader
+        Prewarm,            //!< Running prewarm tasks on the background thread
+        Count,              //!< The number of Phases
+    };
+
+    /**
+    Describes a connected monitor at the time a System was created
+    */
+    struct Monitor final
+    {
+        std::string name;         //!< This Monitor object's name
+        glm::ivec2 position { };  //!< This Monitor object's position in screen coordinates
+        glm::ivec2 extent { };    //!< This Monitor object's current video mode extent
+        int refreshRate { 0 };    //!< This Monitor object's current video mode refresh rate in Hz
+        bool primary { false };   //!< Whether or not this Monitor is the primary Monitor
+    };
+
+    /**
+    Configuration parameters for System construction
+    */
+    struct Info final
+    {
+        /**
+        Specifies System prewarm options
+        */
+        enum class Flags
+        {
+            PrewarmFontAtlas = 1,                //!< The default ImFontAtlas is built during prewarm, see get_font_atlas()
+            Default          = PrewarmFontAtlas, //!< The default Flags
+        };
+
+        Flags flags { Flags::Default };
+        #ifdef DYNAMIC_STATIC_SYSTEM_OPENGL_ENABLED
+        Window::GlInfo* pGlInfo { }; //!< If set a hidden Window is created, prewarm tasks run with its OpenGL context current and Windows can join its share group via get_share_window()
+        #endif // DYNAMIC_STATIC_SYSTEM_OPENGL_ENABLED
+    };
+
+    /**
+    Constructs an instance of System with default System::Info
+    */
+    System();
+
+    /**
+    Constructs an instance of System
+        @note Initializes GLFW, enumerates Monitors, and creates the share Window if Info::pGlInfo is set
+    @param [in] info This System object's System::Info
+    */
+    System(const Info& info);
+
+    /**
+    Destroys this instance of System
+        @note Waits for prewarm to complete
+    */
+    ~System();
+
+    System(const System&) = delete;
+    System& operator=(const System&) = delete;
+
+    /**
+    Begins running prewarm tasks on a background thread
+        @note Tasks run in order with the share Window's OpenGL context current, objects they create are shared with Windows created with get_share_window() as their Window::Info::pShareWindow
+        @note Tasks must not call GLFW functions that are restricted to the main thread
+    @param [in] tasks The tasks to run after the ImFontAtlas is built
+    */
+    void begin_prewarm(std::vector<std::function<void()>> tasks = { });
+
+    /**
+    Waits for prewarm to complete
+        @note If a prewarm task threw an exception it's rethrown here
+    */
+    void end_prewarm();
+
+    /**
+    Gets the ImFontAtlas built during prewarm
+    @return The ImFontAtlas built during prewarm, or nullptr if Info::Flags::PrewarmFontAtlas isn't set or end_prewarm() hasn't been called
+    */
+    ImFontAtlas* get_font_atlas();
+
+    /**
+    Gets the Monitors enumerated when this System was created
+    @return The Monitors enumerated when this System was created
+    */
+    const std::vector<Monitor>& get_monitors() const;
+
+    /**
+    Gets the number of seconds spent in a given Phase
+        @note Phase::Prewarm is only reported after end_prewarm() has been called
+    @param [in] phase The Phase to get the duration of
+    @return The number of seconds spent in the given Phase
+    */
+    double get_phase_time(Phase phase) const;
+
+    #ifdef DYNAMIC_STATIC_SYSTEM_OPENGL_ENABLED
+    /**
+    Gets this System object's share Window
+        @note Waits for prewarm tasks to complete since creating a context in the share Window's share group fails on some platforms while its context is current on the prewarm thread
+        @note Exceptions thrown by prewarm tasks are still only rethrown by end_prewarm()
+    @return This System object's share Window, or nullptr if Info::pGlInfo wasn't set
+    */
+    const Window* get_share_window();
+    #endif // DYNAMIC_STATIC_SYSTEM_OPENGL_ENABLED
+
+private:
+    void prewarm(std::vector<std::function<void()>> tasks);
+    void join_prewarm();
+
+    Info mInfo { };
+    std::vector<Monitor> mMonitors;
+    std::array<double, (size_t)Phase::Count> mPhaseTimes { };
+    std::unique_ptr<ImFontAtlas> mFontAtlas;
+    bool mFontAtlasReady { false };
+    std::thread mPrewarmThread;
+    std::exception_ptr mPrewarmException;
+    #ifdef DYNAMIC_STATIC_SYSTEM_OPENGL_ENABLED
+    std::unique_ptr<Window> mShareWindow;
+    #endif // DYNAMIC_STATIC_SYSTEM_OPENGL_ENABLED
+};
+
+} // namespace sys
+
+template <>
+struct EnumClassOperators<sys::System::Info::Flags>
+{
+    static constexpr bool enabled { true };
+};
+
+} // namespace dst
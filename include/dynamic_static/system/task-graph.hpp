@@ -0,0 +1,142 @@
+
+/*
+==========================================
+  Copyright (c) 2020 Dynamic_Static
+    Patrick Purcell
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#pragma once
+
+#include "dynamic_static/system/defines.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace dst {
+namespace sys {
+
+/**
+Runs a graph of tasks with dependencies on a work stealing pool of worker threads
+    @note A TaskGraph is built once and run() any number of times, typically once per frame
+    @note Tasks with Affinity::Caller run on the thread that calls run(), use this for tasks that need the OpenGL context
+*/
+class TaskGraph final
+{
+public:
+    /**
+    Identifies a task in a TaskGraph
+    */
+    using Task = uint32_t;
+
+    static constexpr Task InvalidTask { std::numeric_limits<Task>::max() }; //!< Value indicating an invalid Task
+
+    /**
+    Specifies which threads a task can run on
+    */
+    enum class Affinity
+    {
+        Any,    //!< The task can run on any worker thread or the thread that calls run()
+        Caller, //!< The task only runs on the thread that calls run()
+    };
+
+    /**
+    Constructs an instance of TaskGraph
+    @param [in] workerCount (optional = 0) The number of worker threads to create, 0 creates one fewer than the number of hardware threads
+    */
+    TaskGraph(uint32_t workerCount = 0);
+
+    /**
+    Destroys this instance of TaskGraph
+    */
+    ~TaskGraph();
+
+    TaskGraph(const TaskGraph&) = delete;
+    TaskGraph& operator=(const TaskGraph&) = delete;
+
+    /**
+    Gets the number of worker threads in this TaskGraph
+    @return The number of worker threads in this TaskGraph
+    */
+    uint32_t get_worker_count() const;
+
+    /**
+    Adds a task to this TaskGraph
+        @note Tasks must not be added while this TaskGraph is running
+    @param [in] function The function to call when the task runs
+    @param [in] affinity (optional = Affinity::Any) The Affinity of the task
+    @return The added Task
+    */
+    Task add_task(std::function<void()> function, Affinity affinity = Affinity::Any);
+
+    /**
+    Adds a dependency between two Tasks
+        @note Dependencies must not be added while this TaskGraph is running
+    @param [in] task The Task that depends on the other Task
+    @param [in] dependency The Task that must complete before the dependent Task runs
+    */
+    void add_dependency(Task task, Task dependency);
+
+    /**
+    Removes all Tasks from this TaskGraph
+    */
+    void clear();
+
+    /**
+    Runs every Task in this TaskGraph, blocking until they've all completed
+        @note The calling thread runs Affinity::Caller Tasks and helps with Affinity::Any Tasks while it waits
+        @note If a Task throws, Tasks that haven't started are skipped and the first exception is rethrown once running Tasks complete
+        @note Throws std::runtime_error if this TaskGraph's dependencies contain a cycle
+    */
+    void run();
+
+private:
+    struct Node final
+    {
+        std::function<void()> function;
+        Affinity affinity { Affinity::Any };
+        std::vector<Task> dependents;
+        uint32_t dependencyCount { 0 };
+    };
+
+    struct Worker final
+    {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    void validate();
+    void enqueue(Task task);
+    bool dequeue(size_t worker_i, Task* pTask);
+    void execute(Task task);
+    void process_tasks(size_t worker_i);
+
+    std::vector<Node> mNodes;
+    bool mValidated { false };
+    std::unique_ptr<std::atomic<uint32_t>[]> mPendingDependencyCounts;
+    size_t mPendingDependencyCountCapacity { 0 };
+    std::vector<std::unique_ptr<Worker>> mWorkers;
+    std::vector<std::thread> mThreads;
+    std::deque<Task> mCallerTasks;
+    std::mutex mMutex;
+    std::condition_variable mConditionVariable;
+    std::atomic<size_t> mQueuedTaskCount { 0 };
+    std::atomic<size_t> mRemainingTaskCount { 0 };
+    std::atomic<size_t> mNextWorker { 0 };
+    std::atomic<bool> mFailed { false };
+    std::exception_ptr mException;
+    bool mStop { false };
+};
+
+} // namespace sys
+} // namespace dst
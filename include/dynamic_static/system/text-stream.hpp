@@ -0,0 +1,101 @@
+
+/*
+==========================================
+  Copyright (c) 2020 Dynamic_Static
+    Patrick Purcell
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#pragma once
+
+#include "dynamic_static/core/span.hpp"
+#include "dynamic_static/system/defines.hpp"
+
+#include <array>
+
+namespace dst {
+namespace sys {
+
+/**
+Stores the text received during a single frame as codepoints and as UTF-8
+    @note TextStream never allocates, codepoints received while it's full are dropped and counted
+*/
+class TextStream final
+{
+public:
+    static constexpr size_t CodepointCapacity { 256 };                 //!< The maximum number of codepoints a TextStream can hold
+    static constexpr size_t Utf8Capacity { CodepointCapacity * 4 + 1 }; //!< The number of bytes reserved for a TextStream object's null terminated UTF-8 encoding
+
+    /**
+    Pushes a codepoint onto this TextStream
+        @note Codepoints that aren't Unicode scalar values, 0, surrogates, and values above 0x10FFFF, are ignored
+    @param [in] codepoint The codepoint to push
+    @return Whether or not the codepoint was pushed, false if it was ignored or this TextStream is full
+    */
+    bool push(uint32_t codepoint);
+
+    /**
+    Gets this TextStream object's codepoints
+    @return This TextStream object's codepoints
+    */
+    dst::Span<const uint32_t> get_codepoints() const;
+
+    /**
+    Gets this TextStream object's codepoints encoded as UTF-8
+    @return This TextStream object's codepoints encoded as a null terminated UTF-8 string
+    */
+    const char* get_utf8() const;
+
+    /**
+    Gets the number of bytes in this TextStream object's UTF-8 encoding
+    @return The number of bytes in this TextStream object's UTF-8 encoding, not including the null terminator
+    */
+    size_t get_utf8_size() const;
+
+    /**
+    Gets the number of codepoints dropped because this TextStream was full
+    @return The number of codepoints dropped since the last call to clear()
+    */
+    size_t get_overflow_count() const;
+
+    /**
+    Gets the number of codepoints in this TextStream
+    @return The number of codepoints in this TextStream
+    */
+    size_t size() const;
+
+    /**
+    Gets a value indicating whether or not this TextStream is empty
+    @return Whether or not this TextStream is empty
+    */
+    bool empty() const;
+
+    /**
+    Gets a pointer to this TextStream object's first codepoint
+    @return A pointer to this TextStream object's first codepoint
+    */
+    const uint32_t* begin() const;
+
+    /**
+    Gets a pointer past this TextStream object's last codepoint
+    @return A pointer past this TextStream object's last codepoint
+    */
+    const uint32_t* end() const;
+
+    /**
+    Clears this TextStream, resetting its overflow count
+    */
+    void clear();
+
+private:
+    std::array<uint32_t, CodepointCapacity> mCodepoints { };
+    std::array<char, Utf8Capacity> mUtf8 { };
+    size_t mCodepointCount { 0 };
+    size_t mUtf8Size { 0 };
+    size_t mOverflowCount { 0 };
+};
+
+} // namespace sys
+} // namespace dst
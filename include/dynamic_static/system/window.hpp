@@ -15,13 +15,20 @@
 #include "dynamic_static/core/math.hpp"
 #include "dynamic_static/core/span.hpp"
 #include "dynamic_static/system/defines.hpp"
+#include "dynamic_static/system/frame-allocator.hpp"
+#include "dynamic_static/system/frame-pacer.hpp"
+#include "dynamic_static/system/frame-stats.hpp"
 #include "dynamic_static/system/input.hpp"
+#include "dynamic_static/system/input-recording.hpp"
+#include "dynamic_static/system/latency-stats.hpp"
+#include "dynamic_static/system/text-stream.hpp"
 #ifdef DYNAMIC_STATIC_SYSTEM_OPENGL_ENABLED
 #include "dynamic_static/system/opengl/defines.hpp"
 #endif // DYNAMIC_STATIC_SYSTEM_OPENGL_ENABLED
 
+#include <limits>
+#include <memory>
 #include <mutex>
-#include <set>
 #include <string>
 #include <vector>
 
@@ -36,6 +43,8 @@ Provides high level control over a system window
 class Window final
 {
 public:
+    static constexpr double GamepadWaitTimeout { 0.008 }; //!< Maximum seconds to wait for events while any gamepad is connected or a Gamepad::Source is set
+
     /**
     TODO : Documentation
     */
@@ -57,15 +66,19 @@ public:
         */
         enum class Flags
         {
-            DoubleBuffer = 1,                   //!< TODO : Documentation
-            VSync        = 1 << 1,              //!< TODO : Documentation
-            Default      = DoubleBuffer | VSync //!< TODO : Documentation
+            DoubleBuffer    = 1,                   //!< TODO : Documentation
+            VSync           = 1 << 1,              //!< Swaps are synchronized with the display's vertical blank
+            AdaptiveVSync   = 1 << 2,              //!< Late swaps tear instead of waiting for the next vertical blank where supported, implies VSync
+            FinishAfterSwap = 1 << 3,              //!< Window::swap() calls glFinish() after swapping so that recorded latency includes GPU completion
+            Default         = DoubleBuffer | VSync //!< TODO : Documentation
         };
 
-        Flags flags { Flags::Default }; //!< TODO : Documentation
-        Version version { 4, 5, 0 };    //!< TODO : Documentation
-        int depthBits { 24 };           //!< TODO : Documentation
-        int stencilBits { 8 };          //!< TODO : Documentation
+        Flags flags { Flags::Default };   //!< TODO : Documentation
+        Version version { 4, 5, 0 };      //!< TODO : Documentation
+        int depthBits { 24 };             //!< TODO : Documentation
+        int stencilBits { 8 };            //!< TODO : Documentation
+        double targetFrameTime { 0 };     //!< The number of seconds Window::swap() paces each frame to, 0 disables pacing
+        uint32_t maxFramesInFlight { 0 }; //!< The number of frames the CPU may run ahead of the GPU, 0 leaves queueing to the driver
     };
     #endif // DYNAMIC_STATIC_SYSTEM_OPENGL_ENABLED
 
@@ -79,11 +92,14 @@ public:
         */
         enum class Flags
         {
-            Decorated    = 1,                               //!< TODO : Documentation
-            Fullscreen   = 1 << 1,                          //!< TODO : Documentation
-            Resizable    = 1 << 2,                          //!< TODO : Documentation
-            Visible      = 1 << 3,                          //!< TODO : Documentation
-            Default      = Decorated | Visible | Resizable, //!< TODO : Documentation
+            Decorated          = 1,                               //!< TODO : Documentation
+            Fullscreen         = 1 << 1,                          //!< TODO : Documentation
+            Resizable          = 1 << 2,                          //!< TODO : Documentation
+            Visible            = 1 << 3,                          //!< TODO : Documentation
+            ThrottleBackground = 1 << 4,                          //!< Window::poll_events() waits for events while this Window is in the background
+            Headless           = 1 << 5,                          //!< This Window renders offscreen to a framebuffer object via EGL, requires Info::pGlInfo and is only supported on Linux
+            RawMouseMotion     = 1 << 6,                          //!< Mouse motion is reported unscaled and unaccelerated while CursorMode::Disabled where supported
+            Default            = Decorated | Visible | Resizable, //!< TODO : Documentation
         };
 
         Flags flags { Flags::Default };
@@ -91,8 +107,11 @@ public:
         glm::ivec2 position { 320, 180 };
         glm::ivec2 extent { 1280, 720 };
         CursorMode cursorMode { CursorMode::Visible };
+        double backgroundWaitTimeout { 0 }; //!< Maximum seconds to wait for events while throttled, 0 waits until an event is received
+        double resizeSettleTime { 0 };      //!< Seconds without a resize before Window::on_resize_settled is fired, 0 fires it alongside Window::on_resize
         #ifdef DYNAMIC_STATIC_SYSTEM_OPENGL_ENABLED
         GlInfo* pGlInfo { };
+        const Window* pShareWindow { }; //!< The Window whose OpenGL share group this Window joins, shared objects include programs, buffers, and textures but not container objects like vertex arrays and framebuffers
         #endif // DYNAMIC_STATIC_SYSTEM_OPENGL_ENABLED
     };
 
@@ -121,10 +140,17 @@ public:
     Window& operator=(Window&& other) noexcept;
 
     /**
-    TODO : Documentation
+    Fired at most once per call to poll_events() or wait_events() when this Window has been resized
+        @note Intermediate sizes received during a single call are coalesced, handlers only observe the latest extent
     */
     Event<Window, const Window&> on_resize;
 
+    /**
+    Fired once this Window hasn't been resized for Info::resizeSettleTime seconds
+        @note Use this Event for expensive reallocations that shouldn't happen for every intermediate size during an interactive resize
+    */
+    Event<Window, const Window&> on_resize_settled;
+
     /**
     TODO : Documentation
     */
@@ -136,39 +162,132 @@ public:
     const Info& get_info() const;
 
     /**
-    TODO : Documentation
+    Gets this Window object's parent
+    @return This Window object's parent, or nullptr if this Window isn't a child
     */
     const Window* get_parent() const;
 
     /**
-    TODO : Documentation
+    Gets this Window object's parent
+    @return This Window object's parent, or nullptr if this Window isn't a child
     */
     Window* get_parent();
 
     /**
-    TODO : Documentation
+    Gets this Window object's children
+        @note Children are owned by this Window, their addresses are stable for their lifetime
+    @return This Window object's children
     */
-    dst::Span<const Window> get_children() const;
+    dst::Span<const std::unique_ptr<Window>> get_children() const;
 
     /**
     TODO : Documentation
     */
-    dst::Span<Window> get_children();
+    const Input& get_input() const;
 
     /**
     TODO : Documentation
     */
-    const Input& get_input() const;
+    Input& get_input();
 
     /**
-    TODO : Documentation
+    Gets the text received by this Window during the most recent call to poll_events()
+    @return The TextStream received by this Window during the most recent call to poll_events()
     */
-    Input& get_input();
+    const TextStream& get_text_stream() const;
 
     /**
-    TODO : Documentation
+    Gets this Window object's FrameAllocator
+        @note This Window object's FrameAllocator is reset when events are processed, allocations are valid until the next call to poll_events()
+    @return This Window object's FrameAllocator
+    */
+    FrameAllocator& frame_allocator();
+
+    /**
+    Gets this Window object's FrameStats
+    @return This Window object's FrameStats
+    */
+    const FrameStats& get_frame_stats() const;
+
+    /**
+    Gets this Window object's LatencyStats
+        @note swap() records the latency of each Input::Event consumed by the first frame presented after the Input::Event was processed
+        @note Latency isn't recorded while replaying Input::Events
+    @return This Window object's LatencyStats
+    */
+    const LatencyStats& get_latency_stats() const;
+
+    /**
+    Gets this Window object's LatencyStats
+    @return This Window object's LatencyStats
+    */
+    LatencyStats& get_latency_stats();
+
+    /**
+    Gets this Window object's FrameStats
+        @note Event processing time is recorded for every Window, swap() records swap time and ends the frame, Windows that don't swap should call FrameStats::end_frame() manually
+    @return This Window object's FrameStats
+    */
+    FrameStats& get_frame_stats();
+
+    /**
+    Gets a value indicating whether or not this Window has input focus
+    @return Whether or not this Window has input focus
     */
-    dst::Span<const uint32_t> get_text_stream() const;
+    bool is_focused() const;
+
+    /**
+    Gets a value indicating whether or not this Window is iconified
+    @return Whether or not this Window is iconified
+    */
+    bool is_iconified() const;
+
+    /**
+    Gets a value indicating whether or not this Window is in the background
+        @note A Window is in the background when it's iconified, unfocused, or hidden
+    @return Whether or not this Window is in the background
+    */
+    bool is_background() const;
+
+    /**
+    Gets a value indicating whether or not this Window is recording Input::Events
+    @return Whether or not this Window is recording Input::Events
+    */
+    bool is_recording_input() const;
+
+    /**
+    Begins recording this Window object's Input::Events and frame boundaries to a given file
+        @note This Window object's Input is reset and its current extent is recorded so that replay begins from identical state
+        @note Throws std::runtime_error if the file can't be opened
+    @param [in] filePath The path of the Input recording file to write
+    */
+    void begin_input_recording(const std::filesystem::path& filePath);
+
+    /**
+    Ends recording this Window object's Input::Events
+    */
+    void end_input_recording();
+
+    /**
+    Gets a value indicating whether or not this Window is replaying Input::Events
+    @return Whether or not this Window is replaying Input::Events
+    */
+    bool is_replaying_input() const;
+
+    /**
+    Begins replaying Input::Events from a given file, one recorded frame per call to poll_events() or wait_events()
+        @note While replaying, this Window ignores input events from the system and won't throttle in the background
+        @note System resizes are still applied to Info::extent while replaying, recorded Resize events are only replayed as Input::Events
+        @note Replay ends automatically when the end of the file is reached
+        @note Throws std::runtime_error if the file can't be opened or isn't a supported Input recording file
+    @param [in] filePath The path of the Input recording file to read
+    */
+    void begin_input_replay(const std::filesystem::path& filePath);
+
+    /**
+    Ends replaying Input::Events, this Window resumes processing input from the system
+    */
+    void end_input_replay();
 
     #ifdef DYNAMIC_STATIC_PLATFORM_WINDOWS
     /**
@@ -192,13 +311,35 @@ public:
     */
     void set_name(const std::string& name);
 
+    /**
+    Sets this Window object's extent
+        @note Headless Windows apply the extent immediately, reallocating their framebuffer object's attachments and staging a Resize Input::Event
+        @note Other Windows request the extent from the system, Info::extent is updated when the resulting Resize Input::Event is processed
+    @param [in] extent The extent to set
+    */
+    void set_extent(const glm::ivec2& extent);
+
     /**
     TODO : Documentation
     */
     void set_cursor_mode(CursorMode cursorMode);
 
     /**
-    TODO : Documentation
+    Sets whether or not this Window reports raw mouse motion
+        @note Raw mouse motion is only reported while CursorMode::Disabled, use Mouse::motion_delta() to read it
+        @note If raw mouse motion isn't supported mouse motion is reported with the platform's scaling and acceleration applied
+    @param [in] rawMouseMotion Whether or not this Window reports raw mouse motion
+    */
+    void set_raw_mouse_motion(bool rawMouseMotion);
+
+    /**
+    Creates a child Window
+        @note If Info::pGlInfo is set and Info::pShareWindow isn't, the child joins this Window object's OpenGL share group
+        @note Children of headless Windows are headless
+        @note Children's events are processed in the same pass as their parent's and children are destroyed before their parent
+        @note Children are heap allocated so pointers to children and the Events of children remain valid when another child is created or when this Window is moved
+    @param [in] info The Window::Info to create the child with
+    @return The child Window
     */
     Window* create_child(const Info& info);
 
@@ -215,46 +356,215 @@ public:
 
     /**
     TODO : Documentation
+        @note If this Window object's FramePacer has a target frame time this method blocks until the next frame's deadline before swapping
+        @note Headless Windows flush their OpenGL context instead of swapping
+        @note This Window object's OpenGL context is made current before swapping and remains current afterward
     */
     void swap();
+
+    /**
+    Presents multiple Windows together so that vsynced Windows don't serialize on their swaps
+        @note Each Window's commands are flushed before any Window swaps, then the first Window with a nonzero swap interval swaps synchronized to the vertical blank and the remaining Windows swap immediately after with a swap interval of 0
+        @note Each Window is paced, fenced, and records FrameStats and LatencyStats as it would in swap(), FramePacer waits are only made for the synchronized Window
+        @note This method leaves the OpenGL context of the last Window presented current
+    @param [in] windows The Windows to present
+    */
+    static void present(dst::Span<Window* const> windows);
+
+    /**
+    Gets this Window object's default framebuffer
+        @note Headless Windows render to a framebuffer object that's bound when this Window object's context is made current, other Windows return 0
+    @return This Window object's default framebuffer
+    */
+    GLuint get_framebuffer() const;
+
+    /**
+    Gets this Window object's swap interval
+    @return This Window object's swap interval
+    */
+    int get_swap_interval() const;
+
+    /**
+    Sets this Window object's swap interval
+        @note This method makes this Window object's OpenGL context current
+        @note Negative swap intervals request adaptive vsync, if adaptive vsync isn't supported the absolute value is used instead
+    @param [in] swapInterval The number of vertical blanks to wait for before swapping
+    */
+    void set_swap_interval(int swapInterval);
+
+    /**
+    Gets this Window object's FramePacer
+    @return This Window object's FramePacer
+    */
+    const FramePacer& get_frame_pacer() const;
+
+    /**
+    Gets this Window object's FramePacer
+    @return This Window object's FramePacer
+    */
+    FramePacer& get_frame_pacer();
+
+    /**
+    Gets the number of frames this Window lets the CPU run ahead of the GPU
+    @return The number of frames this Window lets the CPU run ahead of the GPU, 0 if queueing is left to the driver
+    */
+    uint32_t get_max_frames_in_flight() const;
+
+    /**
+    Sets the number of frames this Window lets the CPU run ahead of the GPU
+        @note When enabled swap() inserts a fence after each swap and waits on the fence from maxFramesInFlight frames back before returning
+        @note This method makes this Window object's OpenGL context current
+    @param [in] maxFramesInFlight The number of frames the CPU may run ahead of the GPU, 0 leaves queueing to the driver
+    */
+    void set_max_frames_in_flight(uint32_t maxFramesInFlight);
     #endif // DYNAMIC_STATIC_SYSTEM_OPENGL_ENABLED
 
     /**
-    TODO : Documentation
+    Processes pending events for all Windows without blocking
+        @note If every Window has Window::Info::Flags::ThrottleBackground set and is in the background this method waits for events instead
     */
     static void poll_events();
 
+    /**
+    Blocks until at least one event is available, then processes pending events for all Windows
+        @note Gamepad activity doesn't generate events, while any gamepad is connected or a Gamepad::Source is set the wait is bounded by GamepadWaitTimeout
+    */
+    static void wait_events();
+
+    /**
+    Blocks until at least one event is available or the given timeout elapses, then processes pending events for all Windows
+        @note Gamepad activity doesn't generate events, while any gamepad is connected or a Gamepad::Source is set the wait is bounded by GamepadWaitTimeout
+    @param [in] timeout The maximum number of seconds to wait
+    */
+    static void wait_events(double timeout);
+
+    /**
+    Posts an empty event, causing a thread blocked in wait_events() to return
+        @note This method may be called from any thread
+    */
+    static void post_empty_event();
+
+    /**
+    Sets the Gamepad::Source polled by poll_events() and wait_events()
+        @note Gamepads are polled once per call to poll_events() or wait_events(), changes are staged as Input::Events for every Window
+        @note Gamepads are polled after waiting for events, Window::post_empty_event() can be used to wake a waiting thread when a Gamepad::Source changes
+        @note By default gamepads are polled through GLFW, pass nullptr to restore the default
+    @param [in] gamepadSource The Gamepad::Source to poll
+    */
+    static void set_gamepad_source(const std::shared_ptr<Gamepad::Source>& gamepadSource);
+
+    /**
+    Sets the Gamepad::Responses applied to polled gamepad Axis values
+    @param [in] stickResponse The Gamepad::Response to apply to stick Axis values
+    @param [in] triggerResponse The Gamepad::Response to apply to trigger Axis values
+    */
+    static void set_gamepad_responses(const Gamepad::Response& stickResponse, const Gamepad::Response& triggerResponse);
+
 private:
+    class Registry;
+    struct Handle final
+    {
+        uint32_t index { std::numeric_limits<uint32_t>::max() };
+        uint32_t generation { 0 };
+    };
+
+    struct Callback final
+    {
+        enum class Type
+        {
+            Resize,
+            ResizeSettled,
+            CloseRequested,
+        };
+
+        Type type { };
+        Handle handle { };
+    };
+
+    friend class System;
     static std::mutex sMutex;
-    static std::set<GLFWwindow*> sGlfwWindows;
+    static Registry sRegistry;
+    static uint32_t sGlfwReferenceCount;
+    static std::shared_ptr<Gamepad::Source> sGamepadSource;
+    static Gamepad::Response sGamepadStickResponse;
+    static Gamepad::Response sGamepadTriggerResponse;
+    static Gamepad::State sGamepadState;
     template <typename FunctionType>
-    static inline void access_glfw_windows(FunctionType function)
+    static inline void access_registry(FunctionType function)
     {
         std::lock_guard<std::mutex> lock(sMutex);
-        function(sGlfwWindows);
+        function(sRegistry);
     }
 
     static std::string& get_last_glfw_error_message();
     static void glfw_error_callback(int error, const char* pMessage);
+    template <typename FunctionType>
+    static void process_events(FunctionType getGlfwWaitTimeout);
+    static bool get_background_wait_timeout(const Registry& registry, double* pTimeout);
+    static bool has_glfw_windows(const Registry& registry);
+    static void poll_gamepads();
+    double get_resize_settle_elapsed() const;
+    void destroy();
+    void begin_processing_events();
+    void end_processing_events(double pollSeconds, std::vector<Callback>* pCallbacks);
+
     static void glfw_window_close_callback(GLFWwindow* pGlfwWindow);
+    static void glfw_window_iconify_callback(GLFWwindow* pGlfwWindow, int iconified);
+    static void glfw_window_focus_callback(GLFWwindow* pGlfwWindow, int focused);
     static void glfw_framebuffer_size_callback(GLFWwindow* pGlfwWindow, int width, int height);
     static void glfw_keyboard_callback(GLFWwindow* pGlfwWindow, int key, int scancode, int action, int mods);
     static void glfw_char_callback(GLFWwindow* pGlfwWindow, unsigned int codepoint);
     static void glfw_mouse_position_callback(GLFWwindow* pGlfwWindow, double xOffset, double yOffset);
     static void glfw_mouse_button_callback(GLFWwindow* pGlfwWindow, int button, int action, int mods);
     static void glfw_mouse_scroll_callback(GLFWwindow* pGlfwWindow, double xOffset, double yOffset);
-    static GLFWwindow* create_glfw_window(const Info& info);
-    static void destroy_glfw_window(GLFWwindow* pGlfwWindow);
+    static void poll_glfw_gamepads(Gamepad::State* pState);
+    static void acquire_glfw();
+    static void release_glfw();
+    static GLFWwindow* create_glfw_window(const Registry& registry, const Info& info);
+    static void destroy_glfw_window(const Registry& registry, GLFWwindow* pGlfwWindow);
     static Keyboard::Key glfw_to_dst_key(int glfwKey);
     static Mouse::Button glfw_to_dst_mouse_button(int glfwMouseButton);
+    Window(Window* pParent, const Info& info);
+    void process_glfw_event(const Input::Event& event);
+    void process_event(const Input::Event& event);
+    void stage_gamepad_events(const Gamepad::State& state);
+    #ifdef DYNAMIC_STATIC_SYSTEM_OPENGL_ENABLED
+    void apply_swap_interval(int swapInterval);
+    void swap(int swapInterval, bool pace);
+    #endif // DYNAMIC_STATIC_SYSTEM_OPENGL_ENABLED
 
+    Handle mHandle;
     Info mInfo;
     Input mInput;
-    std::vector<uint32_t> mTextStream;
+    FrameStats mFrameStats;
+    LatencyStats mLatencyStats;
+    InputRecorder mInputRecorder;
+    InputReplayer mInputReplayer;
+    TextStream mTextStream;
+    FrameAllocator mFrameAllocator;
     std::string mName { "Dynamic_Static" };
     GLFWwindow* mGlfwWindow { nullptr };
-    GLFWwindow* mParentGlfwWindow { nullptr };
-    std::vector<Window> mChildren;
+    Window* mpParent { nullptr };
+    std::vector<std::unique_ptr<Window>> mChildren;
+    #ifdef DYNAMIC_STATIC_SYSTEM_OPENGL_ENABLED
+    #ifdef DYNAMIC_STATIC_PLATFORM_LINUX
+    class EglContext;
+    std::unique_ptr<EglContext> mEglContext;
+    #endif // DYNAMIC_STATIC_PLATFORM_LINUX
+    FramePacer mFramePacer;
+    int mSwapInterval { 0 };
+    int mAppliedSwapInterval { 0 };
+    std::vector<GLsync> mFrameFences;
+    size_t mFrameFenceIndex { 0 };
+    #endif // DYNAMIC_STATIC_SYSTEM_OPENGL_ENABLED
+    bool mFocused { false };
+    bool mIconified { false };
+    bool mLatencyPending { false };
+    bool mResized { false };
+    bool mResizeSettling { false };
+    dst::TimePoint<> mResizeTimePoint { };
+    bool mCloseRequested { false };
+    Gamepad::State mPolledGamepadState { };
     Window(const Window&) = delete;
     Window& operator=(const Window&) = delete;
 };
@@ -0,0 +1,299 @@
+
+/*
+==========================================
+  Copyright (c) 2020 Dynamic_Static
+    Patrick Purcell
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#include "dynamic_static/system/allocation-tracker.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <new>
+#include <stdexcept>
+
+namespace dst {
+namespace sys {
+namespace {
+
+struct AtomicCounts final
+{
+    std::atomic<uint64_t> allocationCount { 0 };
+    std::atomic<uint64_t> allocatedBytes { 0 };
+    std::atomic<uint64_t> deallocationCount { 0 };
+};
+
+struct SiteRecord final
+{
+    std::atomic<const char*> pName { nullptr };
+    AtomicCounts total;
+    AtomicCounts frame;
+    AtomicCounts lastFrame;
+    AtomicCounts maxFrame;
+};
+
+// NOTE : Everything here is constant initialized so that allocations made
+//  during static initialization are counted safely.  Record 0 collects
+//  untagged allocations and allocations from Sites beyond SiteCapacity.
+std::array<SiteRecord, AllocationTracker::SiteCapacity> sSiteRecords;
+AtomicCounts sTotal;
+AtomicCounts sFrame;
+AtomicCounts sLastFrame;
+std::atomic<uint64_t> sFrameIndex { 0 };
+thread_local const char* tlpSiteName { nullptr };
+
+AllocationTracker::Counts load(const AtomicCounts& atomicCounts)
+{
+    AllocationTracker::Counts counts { };
+    counts.allocationCount = atomicCounts.allocationCount.load(std::memory_order_relaxed);
+    counts.allocatedBytes = atomicCounts.allocatedBytes.load(std::memory_order_relaxed);
+    counts.deallocationCount = atomicCounts.deallocationCount.load(std::memory_order_relaxed);
+    return counts;
+}
+
+#ifdef DYNAMIC_STATIC_SYSTEM_ALLOCATION_TRACKING_ENABLED
+void roll(AtomicCounts& frame, AtomicCounts& lastFrame, AtomicCounts* pMaxFrame = nullptr)
+{
+    auto roll_count =
+        [](std::atomic<uint64_t>& frameCount, std::atomic<uint64_t>& lastFrameCount, std::atomic<uint64_t>* pMaxFrameCount)
+        {
+            auto count = frameCount.exchange(0, std::memory_order_relaxed);
+            lastFrameCount.store(count, std::memory_order_relaxed);
+            if (pMaxFrameCount && pMaxFrameCount->load(std::memory_order_relaxed) < count) {
+                pMaxFrameCount->store(count, std::memory_order_relaxed);
+            }
+        };
+    roll_count(frame.allocationCount, lastFrame.allocationCount, pMaxFrame ? &pMaxFrame->allocationCount : nullptr);
+    roll_count(frame.allocatedBytes, lastFrame.allocatedBytes, pMaxFrame ? &pMaxFrame->allocatedBytes : nullptr);
+    roll_count(frame.deallocationCount, lastFrame.deallocationCount, pMaxFrame ? &pMaxFrame->deallocationCount : nullptr);
+}
+
+SiteRecord& get_site_record(const char* pName)
+{
+    if (pName) {
+        // NOTE : Sites are keyed by name pointer and claimed with a compare and
+        //  exchange so this never allocates or locks.
+        auto recordCount = sSiteRecords.size() - 1;
+        auto hash = (size_t)(((uintptr_t)pName >> 3) * 0x9E3779B97F4A7C15ull);
+        for (size_t probe_i = 0; probe_i < recordCount; ++probe_i) {
+            auto& siteRecord = sSiteRecords[1 + (hash + probe_i) % recordCount];
+            auto pSiteName = siteRecord.pName.load(std::memory_order_acquire);
+            if (!pSiteName && siteRecord.pName.compare_exchange_strong(pSiteName, pName, std::memory_order_acq_rel)) {
+                return siteRecord;
+            }
+            if (pSiteName == pName) {
+                return siteRecord;
+            }
+        }
+    }
+    return sSiteRecords[0];
+}
+
+void record_allocation(size_t size)
+{
+    auto& siteRecord = get_site_record(tlpSiteName);
+    for (auto pCounts : { &siteRecord.total, &siteRecord.frame, &sTotal, &sFrame }) {
+        pCounts->allocationCount.fetch_add(1, std::memory_order_relaxed);
+        pCounts->allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+    }
+}
+
+void record_deallocation()
+{
+    auto& siteRecord = get_site_record(tlpSiteName);
+    for (auto pCounts : { &siteRecord.total, &siteRecord.frame, &sTotal, &sFrame }) {
+        pCounts->deallocationCount.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void* allocate(size_t size, size_t alignment)
+{
+    size = size ? size : 1;
+    while (true) {
+        void* pMemory = nullptr;
+        if (alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+            pMemory = std::malloc(size);
+        } else {
+            #ifdef DYNAMIC_STATIC_PLATFORM_WINDOWS
+            pMemory = _aligned_malloc(size, alignment);
+            #else
+            if (posix_memalign(&pMemory, alignment, size)) {
+                pMemory = nullptr;
+            }
+            #endif
+        }
+        if (pMemory) {
+            record_allocation(size);
+            return pMemory;
+        }
+        auto newHandler = std::get_new_handler();
+        if (!newHandler) {
+            throw std::bad_alloc();
+        }
+        newHandler();
+    }
+}
+
+void* allocate_nothrow(size_t size, size_t alignment) noexcept
+{
+    try {
+        return allocate(size, alignment);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void deallocate(void* pMemory, size_t alignment) noexcept
+{
+    if (pMemory) {
+        record_deallocation();
+        #ifdef DYNAMIC_STATIC_PLATFORM_WINDOWS
+        if (__STDCPP_DEFAULT_NEW_ALIGNMENT__ < alignment) {
+            _aligned_free(pMemory);
+            return;
+        }
+        #else
+        (void)alignment;
+        #endif
+        std::free(pMemory);
+    }
+}
+#endif // DYNAMIC_STATIC_SYSTEM_ALLOCATION_TRACKING_ENABLED
+
+} // namespace
+
+AllocationTracker::Scope::Scope(const char* pName)
+    : mpPreviousName { tlpSiteName }
+{
+    tlpSiteName = pName;
+}
+
+AllocationTracker::Scope::~Scope()
+{
+    tlpSiteName = mpPreviousName;
+}
+
+bool AllocationTracker::enabled()
+{
+    #ifdef DYNAMIC_STATIC_SYSTEM_ALLOCATION_TRACKING_ENABLED
+    return true;
+    #else
+    return false;
+    #endif
+}
+
+void AllocationTracker::begin_frame()
+{
+    #ifdef DYNAMIC_STATIC_SYSTEM_ALLOCATION_TRACKING_ENABLED
+    roll(sFrame, sLastFrame);
+    for (size_t siteRecord_i = 0; siteRecord_i < sSiteRecords.size(); ++siteRecord_i) {
+        auto& siteRecord = sSiteRecords[siteRecord_i];
+        if (!siteRecord_i || siteRecord.pName.load(std::memory_order_acquire)) {
+            roll(siteRecord.frame, siteRecord.lastFrame, &siteRecord.maxFrame);
+        }
+    }
+    sFrameIndex.fetch_add(1, std::memory_order_relaxed);
+    #endif
+}
+
+uint64_t AllocationTracker::get_frame_index()
+{
+    return sFrameIndex.load(std::memory_order_relaxed);
+}
+
+AllocationTracker::Counts AllocationTracker::get_last_frame_counts()
+{
+    return load(sLastFrame);
+}
+
+AllocationTracker::Counts AllocationTracker::get_total_counts()
+{
+    return load(sTotal);
+}
+
+void AllocationTracker::get_sites(std::vector<Site>* pSites)
+{
+    assert(pSites);
+    pSites->clear();
+    for (size_t siteRecord_i = 0; siteRecord_i < sSiteRecords.size(); ++siteRecord_i) {
+        const auto& siteRecord = sSiteRecords[siteRecord_i];
+        Site site { };
+        site.pName = siteRecord_i ? siteRecord.pName.load(std::memory_order_acquire) : "untagged";
+        site.total = load(siteRecord.total);
+        if (site.pName && (site.total.allocationCount || site.total.deallocationCount)) {
+            site.lastFrame = load(siteRecord.lastFrame);
+            site.maxFrame = load(siteRecord.maxFrame);
+            pSites->push_back(site);
+        }
+    }
+    std::sort(pSites->begin(), pSites->end(),
+        [](const Site& lhs, const Site& rhs)
+        {
+            return rhs.maxFrame.allocationCount < lhs.maxFrame.allocationCount;
+        }
+    );
+}
+
+void AllocationTracker::write(const std::filesystem::path& filePath)
+{
+    std::vector<Site> sites;
+    get_sites(&sites);
+    std::ofstream file(filePath, std::ios::trunc);
+    if (!file) {
+        throw std::runtime_error("Failed to open allocation tracking file : " + filePath.string());
+    }
+    auto write_counts =
+        [&](const Counts& counts)
+        {
+            file << ',' << counts.allocationCount << ',' << counts.allocatedBytes << ',' << counts.deallocationCount;
+        };
+    file << "frames," << get_frame_index() << '\n';
+    file << "site,allocations,bytes,deallocations";
+    file << ",last frame allocations,last frame bytes,last frame deallocations";
+    file << ",max frame allocations,max frame bytes,max frame deallocations\n";
+    file << "total";
+    write_counts(get_total_counts());
+    write_counts(get_last_frame_counts());
+    file << ",,,\n";
+    for (const auto& site : sites) {
+        file << '"' << site.pName << '"';
+        write_counts(site.total);
+        write_counts(site.lastFrame);
+        write_counts(site.maxFrame);
+        file << '\n';
+    }
+}
+
+} // namespace sys
+} // namespace dst
+
+#ifdef DYNAMIC_STATIC_SYSTEM_ALLOCATION_TRACKING_ENABLED
+void* operator new(std::size_t size) { return dst::sys::allocate(size, 0); }
+void* operator new[](std::size_t size) { return dst::sys::allocate(size, 0); }
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept { return dst::sys::allocate_nothrow(size, 0); }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return dst::sys::allocate_nothrow(size, 0); }
+void* operator new(std::size_t size, std::align_val_t alignment) { return dst::sys::allocate(size, (size_t)alignment); }
+void* operator new[](std::size_t size, std::align_val_t alignment) { return dst::sys::allocate(size, (size_t)alignment); }
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return dst::sys::allocate_nothrow(size, (size_t)alignment); }
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return dst::sys::allocate_nothrow(size, (size_t)alignment); }
+void operator delete(void* pMemory) noexcept { dst::sys::deallocate(pMemory, 0); }
+void operator delete[](void* pMemory) noexcept { dst::sys::deallocate(pMemory, 0); }
+void operator delete(void* pMemory, std::size_t) noexcept { dst::sys::deallocate(pMemory, 0); }
+void operator delete[](void* pMemory, std::size_t) noexcept { dst::sys::deallocate(pMemory, 0); }
+void operator delete(void* pMemory, const std::nothrow_t&) noexcept { dst::sys::deallocate(pMemory, 0); }
+void operator delete[](void* pMemory, const std::nothrow_t&) noexcept { dst::sys::deallocate(pMemory, 0); }
+void operator delete(void* pMemory, std::align_val_t alignment) noexcept { dst::sys::deallocate(pMemory, (size_t)alignment); }
+void operator delete[](void* pMemory, std::align_val_t alignment) noexcept { dst::sys::deallocate(pMemory, (size_t)alignment); }
+void operator delete(void* pMemory, std::size_t, std::align_val_t alignment) noexcept { dst::sys::deallocate(pMemory, (size_t)alignment); }
+void operator delete[](void* pMemory, std::size_t, std::align_val_t alignment) noexcept { dst::sys::deallocate(pMemory, (size_t)alignment); }
+void operator delete(void* pMemory, std::align_val_t alignment, const std::nothrow_t&) noexcept { dst::sys::deallocate(pMemory, (size_t)alignment); }
+void operator delete[](void* pMemory, std::align_val_t alignment, const std::nothrow_t&) noexcept { dst::sys::deallocate(pMemory, (size_t)alignment); }
+#endif // DYNAMIC_STATIC_SYSTEM_ALLOCATION_TRACKING_ENABLED
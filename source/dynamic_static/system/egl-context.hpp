@@ -0,0 +1,294 @@
+
+/*
+==========================================
+  Copyright (c) 2020 Dynamic_Static
+    Patrick Purcell
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#pragma once
+
+#include "dynamic_static/system/window.hpp"
+
+#if defined(DYNAMIC_STATIC_SYSTEM_OPENGL_ENABLED) && defined(DYNAMIC_STATIC_PLATFORM_LINUX)
+
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+
+#include <array>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#ifndef EGL_PLATFORM_SURFACELESS_MESA
+#define EGL_PLATFORM_SURFACELESS_MESA 0x31DD
+#endif
+
+namespace dst {
+namespace sys {
+
+/**
+Provides an OpenGL context for headless Windows via EGL
+    @note If EGL_MESA_platform_surfaceless and EGL_KHR_surfaceless_context are available no EGLSurface is created, otherwise a minimal pbuffer is used
+    @note Rendering targets a framebuffer object that's bound in place of the default framebuffer when this EglContext is made current
+    @note The framebuffer object's attachments are reallocated by resize() when the headless Window's extent changes
+    @note EglContexts must be created and destroyed while the Window::Registry is locked
+*/
+class Window::EglContext final
+{
+public:
+    /**
+    Constructs an instance of EglContext
+    @param [in] info The Window::Info of the headless Window to create this EglContext for
+    @param [in] pShareContext (optional = nullptr) The EglContext whose share group this EglContext joins
+    */
+    inline EglContext(const Info& info, const EglContext* pShareContext = nullptr)
+    {
+        assert(info.pGlInfo);
+        try {
+            if (!sEglDisplayReferenceCount) {
+                initialize_egl_display();
+            }
+            ++sEglDisplayReferenceCount;
+            create_egl_context(*info.pGlInfo, pShareContext ? pShareContext->mEglContext : EGL_NO_CONTEXT);
+            make_current();
+            create_framebuffer(*info.pGlInfo, info.extent);
+        } catch (...) {
+            destroy();
+            throw;
+        }
+    }
+
+    /**
+    Destroys this instance of EglContext
+    */
+    inline ~EglContext()
+    {
+        destroy();
+    }
+
+    /**
+    Makes this EglContext current and binds its framebuffer
+    */
+    inline void make_current()
+    {
+        if (!try_make_current()) {
+            throw std::runtime_error("Failed to make EGL context current : " + get_egl_error_message());
+        }
+    }
+
+    /**
+    Makes this EglContext current and binds its framebuffer without throwing
+    @return Whether or not this EglContext was made current
+    */
+    inline bool try_make_current() noexcept
+    {
+        if (eglMakeCurrent(sEglDisplay, mEglSurface, mEglSurface, mEglContext) == EGL_FALSE) {
+            return false;
+        }
+        if (mFramebuffer) {
+            dst_gl(glBindFramebuffer(GL_FRAMEBUFFER, mFramebuffer));
+        }
+        return true;
+    }
+
+    /**
+    Gets this EglContext object's framebuffer
+    @return This EglContext object's framebuffer
+    */
+    inline GLuint get_framebuffer() const
+    {
+        return mFramebuffer;
+    }
+
+    /**
+    Gets the extent of this EglContext object's framebuffer
+    @return The extent of this EglContext object's framebuffer
+    */
+    inline const glm::ivec2& get_extent() const
+    {
+        return mExtent;
+    }
+
+    /**
+    Reallocates this EglContext object's framebuffer attachments at a given extent
+        @note The EGL context that's current on the calling thread is restored before this method returns
+    @param [in] extent The extent to reallocate this EglContext object's framebuffer attachments at
+    */
+    inline void resize(const glm::ivec2& extent)
+    {
+        auto eglDisplay = eglGetCurrentDisplay();
+        auto eglDrawSurface = eglGetCurrentSurface(EGL_DRAW);
+        auto eglReadSurface = eglGetCurrentSurface(EGL_READ);
+        auto eglContext = eglGetCurrentContext();
+        make_current();
+        allocate_renderbuffers(extent);
+        dst_gl(glViewport(0, 0, extent.x, extent.y));
+        if (eglContext != mEglContext) {
+            if (eglDisplay != EGL_NO_DISPLAY) {
+                eglMakeCurrent(eglDisplay, eglDrawSurface, eglReadSurface, eglContext);
+            } else {
+                eglMakeCurrent(sEglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+            }
+        }
+    }
+
+private:
+    static inline std::string get_egl_error_message()
+    {
+        return std::to_string(eglGetError());
+    }
+
+    static inline bool has_egl_extension(const char* pExtensions, const char* pExtension)
+    {
+        if (pExtensions) {
+            auto extensionLength = strlen(pExtension);
+            for (auto pMatch = strstr(pExtensions, pExtension); pMatch; pMatch = strstr(pMatch + extensionLength, pExtension)) {
+                auto terminator = pMatch[extensionLength];
+                if ((pMatch == pExtensions || pMatch[-1] == ' ') && (terminator == ' ' || terminator == '\0')) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    static inline void initialize_egl_display()
+    {
+        sEglDisplay = EGL_NO_DISPLAY;
+        auto pClientExtensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+        auto pfnEglGetPlatformDisplayEXT = (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+        if (pfnEglGetPlatformDisplayEXT && has_egl_extension(pClientExtensions, "EGL_MESA_platform_surfaceless")) {
+            sEglDisplay = pfnEglGetPlatformDisplayEXT(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+        }
+        if (sEglDisplay == EGL_NO_DISPLAY) {
+            sEglDisplay = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+        }
+        if (sEglDisplay == EGL_NO_DISPLAY || eglInitialize(sEglDisplay, nullptr, nullptr) == EGL_FALSE) {
+            sEglDisplay = EGL_NO_DISPLAY;
+            throw std::runtime_error("Failed to initialize EGL display : " + get_egl_error_message());
+        }
+        sEglSurfaceless = has_egl_extension(eglQueryString(sEglDisplay, EGL_EXTENSIONS), "EGL_KHR_surfaceless_context");
+    }
+
+    inline void create_egl_context(const GlInfo& glInfo, EGLContext eglShareContext)
+    {
+        if (eglBindAPI(EGL_OPENGL_API) == EGL_FALSE) {
+            throw std::runtime_error("Failed to bind EGL OpenGL API : " + get_egl_error_message());
+        }
+        const std::array<EGLint, 15> configAttributes {
+            EGL_SURFACE_TYPE, sEglSurfaceless ? 0 : EGL_PBUFFER_BIT,
+            EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+            EGL_RED_SIZE, 8,
+            EGL_GREEN_SIZE, 8,
+            EGL_BLUE_SIZE, 8,
+            EGL_ALPHA_SIZE, 8,
+            EGL_NONE,
+        };
+        EGLConfig eglConfig { };
+        EGLint configCount = 0;
+        if (eglChooseConfig(sEglDisplay, configAttributes.data(), &eglConfig, 1, &configCount) == EGL_FALSE || !configCount) {
+            throw std::runtime_error("Failed to choose EGL config : " + get_egl_error_message());
+        }
+        const std::array<EGLint, 7> contextAttributes {
+            EGL_CONTEXT_MAJOR_VERSION_KHR, glInfo.version.major,
+            EGL_CONTEXT_MINOR_VERSION_KHR, glInfo.version.minor,
+            EGL_CONTEXT_OPENGL_PROFILE_MASK_KHR, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT_KHR,
+            EGL_NONE,
+        };
+        mEglContext = eglCreateContext(sEglDisplay, eglConfig, eglShareContext, contextAttributes.data());
+        if (mEglContext == EGL_NO_CONTEXT) {
+            throw std::runtime_error("Failed to create EGL context : " + get_egl_error_message());
+        }
+        if (!sEglSurfaceless) {
+            const std::array<EGLint, 5> pbufferAttributes {
+                EGL_WIDTH, 1,
+                EGL_HEIGHT, 1,
+                EGL_NONE,
+            };
+            mEglSurface = eglCreatePbufferSurface(sEglDisplay, eglConfig, pbufferAttributes.data());
+            if (mEglSurface == EGL_NO_SURFACE) {
+                throw std::runtime_error("Failed to create EGL pbuffer surface : " + get_egl_error_message());
+            }
+        }
+    }
+
+    inline void create_framebuffer(const GlInfo& glInfo, const glm::ivec2& extent)
+    {
+        dst_gl(glGenRenderbuffers(1, &mColorRenderbuffer));
+        if (glInfo.depthBits || glInfo.stencilBits) {
+            dst_gl(glGenRenderbuffers(1, &mDepthStencilRenderbuffer));
+        }
+        allocate_renderbuffers(extent);
+        dst_gl(glGenFramebuffers(1, &mFramebuffer));
+        dst_gl(glBindFramebuffer(GL_FRAMEBUFFER, mFramebuffer));
+        dst_gl(glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, mColorRenderbuffer));
+        if (mDepthStencilRenderbuffer) {
+            dst_gl(glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, mDepthStencilRenderbuffer));
+        }
+        GLenum framebufferStatus = GL_FRAMEBUFFER_COMPLETE;
+        dst_gl(framebufferStatus = glCheckFramebufferStatus(GL_FRAMEBUFFER));
+        if (framebufferStatus != GL_FRAMEBUFFER_COMPLETE) {
+            throw std::runtime_error("Failed to create headless framebuffer : " + std::to_string(framebufferStatus));
+        }
+        dst_gl(glViewport(0, 0, extent.x, extent.y));
+    }
+
+    inline void allocate_renderbuffers(const glm::ivec2& extent)
+    {
+        dst_gl(glBindRenderbuffer(GL_RENDERBUFFER, mColorRenderbuffer));
+        dst_gl(glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, extent.x, extent.y));
+        if (mDepthStencilRenderbuffer) {
+            dst_gl(glBindRenderbuffer(GL_RENDERBUFFER, mDepthStencilRenderbuffer));
+            dst_gl(glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, extent.x, extent.y));
+        }
+        dst_gl(glBindRenderbuffer(GL_RENDERBUFFER, 0));
+        mExtent = extent;
+    }
+
+    inline void destroy()
+    {
+        if (sEglDisplay != EGL_NO_DISPLAY) {
+            if (mEglContext != EGL_NO_CONTEXT) {
+                if (eglMakeCurrent(sEglDisplay, mEglSurface, mEglSurface, mEglContext) == EGL_TRUE) {
+                    dst_gl(glBindFramebuffer(GL_FRAMEBUFFER, 0));
+                    dst_gl(glDeleteFramebuffers(1, &mFramebuffer));
+                    dst_gl(glDeleteRenderbuffers(1, &mColorRenderbuffer));
+                    dst_gl(glDeleteRenderbuffers(1, &mDepthStencilRenderbuffer));
+                }
+                eglMakeCurrent(sEglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+                eglDestroyContext(sEglDisplay, mEglContext);
+            }
+            if (mEglSurface != EGL_NO_SURFACE) {
+                eglDestroySurface(sEglDisplay, mEglSurface);
+            }
+            if (sEglDisplayReferenceCount && !--sEglDisplayReferenceCount) {
+                eglTerminate(sEglDisplay);
+                sEglDisplay = EGL_NO_DISPLAY;
+            }
+        }
+        mEglContext = EGL_NO_CONTEXT;
+        mEglSurface = EGL_NO_SURFACE;
+        mFramebuffer = 0;
+        mColorRenderbuffer = 0;
+        mDepthStencilRenderbuffer = 0;
+        mExtent = { };
+    }
+
+    static EGLDisplay sEglDisplay;
+    static bool sEglSurfaceless;
+    static uint32_t sEglDisplayReferenceCount;
+    EGLContext mEglContext { EGL_NO_CONTEXT };
+    EGLSurface mEglSurface { EGL_NO_SURFACE };
+    GLuint mFramebuffer { 0 };
+    GLuint mColorRenderbuffer { 0 };
+    GLuint mDepthStencilRenderbuffer { 0 };
+    glm::ivec2 mExtent { };
+};
+
+} // namespace sys
+} // namespace dst
+
+#endif // defined(DYNAMIC_STATIC_SYSTEM_OPENGL_ENABLED) && defined(DYNAMIC_STATIC_PLATFORM_LINUX)
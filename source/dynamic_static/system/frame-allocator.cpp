@@ -0,0 +1,118 @@
+
+/*
+==========================================
+  Copyright (c) 2020 Dynamic_Static
+    Patrick Purcell
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#include "dynamic_static/system/frame-allocator.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <utility>
+
+namespace dst {
+namespace sys {
+
+FrameAllocator::FrameAllocator(size_t capacity)
+    : mCapacity { capacity }
+{
+}
+
+FrameAllocator::FrameAllocator(FrameAllocator&& other) noexcept
+{
+    *this = std::move(other);
+}
+
+FrameAllocator& FrameAllocator::operator=(FrameAllocator&& other) noexcept
+{
+    if (this != &other) {
+        mBlock = std::move(other.mBlock);
+        mCapacity = std::exchange(other.mCapacity, 0);
+        mOverflowBlocks = std::move(other.mOverflowBlocks);
+        other.mOverflowBlocks.clear();
+        mpCurrentBlock = std::exchange(other.mpCurrentBlock, nullptr);
+        mCurrentBlockCapacity = std::exchange(other.mCurrentBlockCapacity, 0);
+        mCurrentBlockOffset = std::exchange(other.mCurrentBlockOffset, 0);
+        mSize = std::exchange(other.mSize, 0);
+        mHighWaterMark = std::exchange(other.mHighWaterMark, 0);
+        mOverflowCount = std::exchange(other.mOverflowCount, 0);
+        mMaxAlignment = std::exchange(other.mMaxAlignment, 0);
+    }
+    return *this;
+}
+
+void* FrameAllocator::allocate(size_t size, size_t alignment)
+{
+    assert(alignment && !(alignment & (alignment - 1)));
+    mMaxAlignment = std::max(mMaxAlignment, alignment);
+    if (!mBlock && mCapacity && mOverflowBlocks.empty()) {
+        mBlock.reset(new std::byte[mCapacity]);
+        mpCurrentBlock = mBlock.get();
+        mCurrentBlockCapacity = mCapacity;
+    }
+    auto get_padding =
+        [&]()
+        {
+            auto address = (uintptr_t)mpCurrentBlock + mCurrentBlockOffset;
+            return ((address + alignment - 1) & ~(uintptr_t)(alignment - 1)) - address;
+        };
+    auto padding = mpCurrentBlock ? get_padding() : 0;
+    if (!mpCurrentBlock || mCurrentBlockCapacity < mCurrentBlockOffset + padding + size) {
+        auto overflowBlockCapacity = std::max(size + alignment, mCapacity);
+        mOverflowBlocks.emplace_back(new std::byte[overflowBlockCapacity]);
+        ++mOverflowCount;
+        mpCurrentBlock = mOverflowBlocks.back().get();
+        mCurrentBlockCapacity = overflowBlockCapacity;
+        mCurrentBlockOffset = 0;
+        padding = get_padding();
+    }
+    auto pAllocation = mpCurrentBlock + mCurrentBlockOffset + padding;
+    mCurrentBlockOffset += padding + size;
+    mSize += padding + size;
+    mHighWaterMark = std::max(mHighWaterMark, mSize);
+    return pAllocation;
+}
+
+void FrameAllocator::reset()
+{
+    if (!mOverflowBlocks.empty()) {
+        mOverflowBlocks.clear();
+        // NOTE : The high water mark includes padding measured against the
+        //  previous blocks' addresses, the largest alignment seen is added so
+        //  the same allocations fit regardless of where the new block lands.
+        mCapacity = std::max(mCapacity * 2, mHighWaterMark + mMaxAlignment);
+        mBlock.reset(new std::byte[mCapacity]);
+    }
+    mpCurrentBlock = mBlock.get();
+    mCurrentBlockCapacity = mCapacity;
+    mCurrentBlockOffset = 0;
+    mSize = 0;
+}
+
+size_t FrameAllocator::get_capacity() const
+{
+    return mCapacity;
+}
+
+size_t FrameAllocator::get_size() const
+{
+    return mSize;
+}
+
+size_t FrameAllocator::get_high_water_mark() const
+{
+    return mHighWaterMark;
+}
+
+size_t FrameAllocator::get_overflow_count() const
+{
+    return mOverflowCount;
+}
+
+} // namespace sys
+} // namespace dst
@@ -0,0 +1,163 @@
+
+/*
+==========================================
+  Copyright (c) 2020 Dynamic_Static
+    Patrick Purcell
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#include "dynamic_static/system/frame-loop.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <utility>
+
+namespace dst {
+namespace sys {
+
+FrameLoop::FrameLoop(const Info& info, TickFunction tickFunction)
+    : mInfo { info }
+    , mTickFunction { std::move(tickFunction) }
+{
+    assert(0 < mInfo.tickTime);
+    assert(mTickFunction);
+    if ((int)(mInfo.flags & Info::Flags::Threaded)) {
+        mThread = std::thread(&FrameLoop::process_ticks, this);
+    }
+}
+
+FrameLoop::~FrameLoop()
+{
+    if (mThread.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mStop = true;
+        }
+        mConditionVariable.notify_all();
+        mThread.join();
+    }
+}
+
+const FrameLoop::Info& FrameLoop::get_info() const
+{
+    return mInfo;
+}
+
+double FrameLoop::update(const Input& input)
+{
+    auto now = dst::HighResolutionClock::now();
+    auto elapsedTime = mStarted ? dst::duration_cast<dst::Seconds<double>>(now - mPreviousTimePoint).count() : 0;
+    mPreviousTimePoint = now;
+    mStarted = true;
+    return update(input, elapsedTime);
+}
+
+double FrameLoop::update(const Input& input, double elapsedTime)
+{
+    wait();
+    mAccumulator += std::max(0.0, elapsedTime);
+    auto tickCount = (uint64_t)std::floor(mAccumulator / mInfo.tickTime);
+    mAccumulator -= tickCount * mInfo.tickTime;
+    if (mInfo.maxTicksPerFrame < tickCount) {
+        mDroppedTickCount += tickCount - mInfo.maxTicksPerFrame;
+        tickCount = mInfo.maxTicksPerFrame;
+    }
+    mAlpha = std::clamp(mAccumulator / mInfo.tickTime, 0.0, 1.0);
+    mTickCount += tickCount;
+    if (tickCount && !mInputCarried && !mThread.joinable()) {
+        run_ticks(input, (uint32_t)tickCount);
+    } else {
+        // NOTE : Frames that don't run a tick are folded into mInput so that
+        //  their presses, releases, scroll, and motion reach the next tick.
+        if (mInputCarried) {
+            mInput.accumulate(input);
+        } else {
+            mInput.snapshot(input);
+        }
+        mInputCarried = !tickCount;
+        if (tickCount) {
+            if (mThread.joinable()) {
+                {
+                    std::lock_guard<std::mutex> lock(mMutex);
+                    mPendingTickCount = (uint32_t)tickCount;
+                    mBusy = true;
+                }
+                mConditionVariable.notify_all();
+            } else {
+                run_ticks(mInput, (uint32_t)tickCount);
+            }
+        }
+    }
+    return mAlpha;
+}
+
+void FrameLoop::wait()
+{
+    if (mThread.joinable()) {
+        std::unique_lock<std::mutex> lock(mMutex);
+        mConditionVariable.wait(lock, [this]() { return !mBusy; });
+        if (mException) {
+            std::rethrow_exception(std::exchange(mException, nullptr));
+        }
+    }
+}
+
+double FrameLoop::get_alpha() const
+{
+    return mAlpha;
+}
+
+uint64_t FrameLoop::get_tick_count() const
+{
+    return mTickCount;
+}
+
+uint64_t FrameLoop::get_dropped_tick_count() const
+{
+    return mDroppedTickCount;
+}
+
+void FrameLoop::run_ticks(const Input& input, uint32_t tickCount)
+{
+    for (uint32_t tick_i = 0; tick_i < tickCount; ++tick_i) {
+        if (tick_i) {
+            // NOTE : Updating without staged Input::Events carries state forward
+            //  while clearing presses, releases, scroll, and motion.  The caller's
+            //  Input is only snapshotted if there's state to carry forward.
+            if (tick_i == 1 && &input != &mInput) {
+                mInput.snapshot(input);
+            }
+            mInput.update();
+        }
+        mTickFunction(mInfo.tickTime, tick_i ? mInput : input);
+    }
+}
+
+void FrameLoop::process_ticks()
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+    while (true) {
+        mConditionVariable.wait(lock, [this]() { return mStop || mPendingTickCount; });
+        if (mStop) {
+            break;
+        }
+        auto tickCount = std::exchange(mPendingTickCount, 0);
+        lock.unlock();
+        std::exception_ptr exception;
+        try {
+            run_ticks(mInput, tickCount);
+        } catch (...) {
+            exception = std::current_exception();
+        }
+        lock.lock();
+        mException = exception;
+        mBusy = false;
+        mConditionVariable.notify_all();
+    }
+}
+
+} // namespace sys
+} // namespace dst
@@ -0,0 +1,109 @@
+
+/*
+==========================================
+  Copyright (c) 2020 Dynamic_Static
+    Patrick Purcell
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#include "dynamic_static/system/frame-pacer.hpp"
+
+#ifdef DYNAMIC_STATIC_PLATFORM_WINDOWS
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <Windows.h>
+#include <timeapi.h>
+#endif // DYNAMIC_STATIC_PLATFORM_WINDOWS
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+namespace dst {
+namespace sys {
+namespace {
+
+#ifdef DYNAMIC_STATIC_PLATFORM_WINDOWS
+class TimerResolution final
+{
+public:
+    TimerResolution()
+    {
+        timeBeginPeriod(1);
+    }
+
+    ~TimerResolution()
+    {
+        timeEndPeriod(1);
+    }
+};
+#endif // DYNAMIC_STATIC_PLATFORM_WINDOWS
+
+} // namespace
+
+FramePacer::FramePacer(double targetFrameTime)
+{
+    set_target_frame_time(targetFrameTime);
+}
+
+double FramePacer::get_target_frame_time() const
+{
+    return mTargetFrameTime;
+}
+
+void FramePacer::set_target_frame_time(double targetFrameTime)
+{
+    mTargetFrameTime = std::max(0.0, targetFrameTime);
+    reset();
+}
+
+void FramePacer::wait()
+{
+    if (0 < mTargetFrameTime) {
+        #ifdef DYNAMIC_STATIC_PLATFORM_WINDOWS
+        // NOTE : The default Windows timer resolution is 15.6 milliseconds, it's
+        //  raised for the remainder of the process once pacing begins.
+        static const TimerResolution sTimerResolution;
+        #endif // DYNAMIC_STATIC_PLATFORM_WINDOWS
+        using Duration = dst::HighResolutionClock::duration;
+        auto targetFrameTime = dst::duration_cast<Duration>(dst::Seconds<double>(mTargetFrameTime));
+        auto now = dst::HighResolutionClock::now();
+        if (now < mDeadline) {
+            auto sleepDuration = dst::duration_cast<Duration>(dst::Seconds<double>(mSleepMargin));
+            if (now + sleepDuration < mDeadline) {
+                // NOTE : Sleep until the deadline less the margin, then track how far
+                //  the sleep overshot.  The margin covers the smoothed oversleep plus
+                //  twice its smoothed deviation so a single spike only nudges it, and
+                //  it's capped so a coarse timer never turns into a long busy wait.
+                auto sleepUntil = mDeadline - sleepDuration;
+                std::this_thread::sleep_until(sleepUntil);
+                auto oversleep = dst::duration_cast<dst::Seconds<double>>(dst::HighResolutionClock::now() - sleepUntil).count();
+                oversleep = std::max(0.0, oversleep);
+                mOversleepDeviation += (std::abs(oversleep - mOversleepMean) - mOversleepDeviation) * 0.25;
+                mOversleepMean += (oversleep - mOversleepMean) * 0.125;
+                mSleepMargin = mOversleepMean + mOversleepDeviation * 2;
+                mSleepMargin = std::min(mSleepMargin, std::min(MaxSleepMargin, mTargetFrameTime * 0.5));
+            }
+            while (dst::HighResolutionClock::now() < mDeadline) {
+                std::this_thread::yield();
+            }
+        } else {
+            mDeadline = now;
+        }
+        mDeadline += targetFrameTime;
+    }
+}
+
+void FramePacer::reset()
+{
+    mDeadline = { };
+}
+
+} // namespace sys
+} // namespace dst
@@ -0,0 +1,194 @@
+
+/*
+==========================================
+  Copyright (c) 2020 Dynamic_Static
+    Patrick Purcell
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#include "dynamic_static/system/frame-stats.hpp"
+#include "dynamic_static/system/allocation-tracker.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <utility>
+
+namespace dst {
+namespace sys {
+
+FrameStats::ScopedPhase::ScopedPhase(FrameStats& frameStats, Phase phase)
+    : mFrameStats { frameStats }
+    , mPhase { phase }
+    , mBegin { dst::HighResolutionClock::now() }
+{
+}
+
+FrameStats::ScopedPhase::~ScopedPhase()
+{
+    mFrameStats.record(mPhase, dst::duration_cast<dst::Seconds<double>>(dst::HighResolutionClock::now() - mBegin).count());
+}
+
+FrameStats::FrameStats(double hitchThreshold)
+{
+    set_hitch_threshold(hitchThreshold);
+    reset();
+}
+
+double FrameStats::get_hitch_threshold() const
+{
+    return mHitchThreshold;
+}
+
+void FrameStats::set_hitch_threshold(double hitchThreshold)
+{
+    mHitchThreshold = std::max(0.0, hitchThreshold);
+}
+
+uint64_t FrameStats::get_hitch_count() const
+{
+    return mHitchCount;
+}
+
+uint64_t FrameStats::get_frame_count() const
+{
+    return mFrameCount;
+}
+
+double FrameStats::get_last(Phase phase) const
+{
+    assert(phase < Phase::Count);
+    return mSampleCount ? mSamples[(size_t)phase][get_last_sample_index()] : 0;
+}
+
+FrameStats::Summary FrameStats::get_summary(Phase phase) const
+{
+    assert(phase < Phase::Count);
+    Summary summary { };
+    summary.sampleCount = mSampleCount;
+    if (mSampleCount) {
+        // NOTE : Samples are partitioned progressively so each percentile only
+        //  searches the range above the previous one.  Percentiles use the
+        //  nearest rank method.
+        const auto& samples = mSamples[(size_t)phase];
+        std::copy_n(samples.begin(), mSampleCount, mScratch.begin());
+        auto begin = mScratch.begin();
+        auto end = mScratch.begin() + mSampleCount;
+        auto get_percentile =
+        [&](double percentile)
+        {
+            auto rank = (size_t)std::ceil(percentile * mSampleCount);
+            auto itr = mScratch.begin() + (rank ? rank - 1 : 0);
+            std::nth_element(begin, itr, end);
+            begin = itr;
+            return *itr;
+        };
+        summary.p50 = get_percentile(0.50);
+        summary.p95 = get_percentile(0.95);
+        summary.p99 = get_percentile(0.99);
+        summary.max = *std::max_element(begin, end);
+    }
+    return summary;
+}
+
+uint64_t FrameStats::get_last_allocation_count() const
+{
+    return mLastAllocationCount;
+}
+
+uint64_t FrameStats::get_last_allocated_bytes() const
+{
+    return mLastAllocatedBytes;
+}
+
+uint64_t FrameStats::get_max_allocation_count() const
+{
+    return mMaxAllocationCount;
+}
+
+void FrameStats::record(Phase phase, double seconds)
+{
+    assert(phase < Phase::Count);
+    assert(phase != Phase::Frame && "The Frame Phase is measured by FrameStats::end_frame()");
+    mCurrent[(size_t)phase] += seconds;
+}
+
+void FrameStats::record_allocations(uint64_t allocationCount, uint64_t allocatedBytes)
+{
+    mCurrentAllocationCount += allocationCount;
+    mCurrentAllocatedBytes += allocatedBytes;
+}
+
+void FrameStats::end_frame()
+{
+    auto now = dst::HighResolutionClock::now();
+    auto& frameTime = mCurrent[(size_t)Phase::Frame];
+    if (mFrameBegin != dst::TimePoint<> { }) {
+        frameTime = dst::duration_cast<dst::Seconds<double>>(now - mFrameBegin).count();
+    } else {
+        for (size_t phase_i = 0; phase_i < (size_t)Phase::Frame; ++phase_i) {
+            frameTime += mCurrent[phase_i];
+        }
+    }
+    mFrameBegin = now;
+    // NOTE : AllocationTracker's totals are sampled here rather than when events
+    //  are processed so that allocations are recorded to the frame they were
+    //  made in.  Counts are process wide, every FrameStats sees every allocation.
+    auto allocationCounts = AllocationTracker::get_total_counts();
+    record_allocations(
+        allocationCounts.allocationCount - std::exchange(mTrackedAllocationCount, allocationCounts.allocationCount),
+        allocationCounts.allocatedBytes - std::exchange(mTrackedAllocatedBytes, allocationCounts.allocatedBytes)
+    );
+    auto hitchThreshold = mHitchThreshold;
+    if (!hitchThreshold && mSampleCount) {
+        hitchThreshold = get_summary(Phase::Frame).p50 * 2;
+    }
+    if (hitchThreshold && hitchThreshold < frameTime) {
+        ++mHitchCount;
+    }
+    size_t sampleIndex = 0;
+    if (mSampleCount < SampleCapacity) {
+        sampleIndex = (mSampleBegin + mSampleCount) % SampleCapacity;
+        ++mSampleCount;
+    } else {
+        sampleIndex = mSampleBegin;
+        mSampleBegin = (mSampleBegin + 1) % SampleCapacity;
+    }
+    for (size_t phase_i = 0; phase_i < (size_t)Phase::Count; ++phase_i) {
+        mSamples[phase_i][sampleIndex] = mCurrent[phase_i];
+        mCurrent[phase_i] = 0;
+    }
+    mLastAllocationCount = std::exchange(mCurrentAllocationCount, 0);
+    mLastAllocatedBytes = std::exchange(mCurrentAllocatedBytes, 0);
+    mMaxAllocationCount = std::max(mMaxAllocationCount, mLastAllocationCount);
+    ++mFrameCount;
+}
+
+void FrameStats::reset()
+{
+    mCurrent = { };
+    mSampleBegin = 0;
+    mSampleCount = 0;
+    mHitchCount = 0;
+    mFrameCount = 0;
+    mFrameBegin = { };
+    mCurrentAllocationCount = 0;
+    mCurrentAllocatedBytes = 0;
+    mLastAllocationCount = 0;
+    mLastAllocatedBytes = 0;
+    mMaxAllocationCount = 0;
+    auto allocationCounts = AllocationTracker::get_total_counts();
+    mTrackedAllocationCount = allocationCounts.allocationCount;
+    mTrackedAllocatedBytes = allocationCounts.allocatedBytes;
+}
+
+size_t FrameStats::get_last_sample_index() const
+{
+    assert(mSampleCount);
+    return (mSampleBegin + mSampleCount - 1) % SampleCapacity;
+}
+
+} // namespace sys
+} // namespace dst
@@ -0,0 +1,238 @@
+
+/*
+==========================================
+  Copyright (c) 2020 Dynamic_Static
+    Patrick Purcell
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#include "dynamic_static/system/gamepad.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+
+namespace dst {
+namespace sys {
+namespace {
+
+// NOTE : Each loop runs across every gamepad's value for a single Axis so
+//  that the compiler vectorizes it.  The loops are kept free of conditionals,
+//  clamps are written in terms of std::abs() because GCC's partial redundancy
+//  elimination turns a conditional clamp followed by the response curve into
+//  a branch.  The square root is in its own loop since it's only vectorized
+//  when math errno is disabled.
+inline float get_min(float a, float b)
+{
+    return 0.5f * (a + b - std::abs(a - b));
+}
+
+inline float get_max(float a, float b)
+{
+    return 0.5f * (a + b + std::abs(a - b));
+}
+
+struct ResponseParameters final
+{
+    ResponseParameters(const Gamepad::Response& response)
+        : deadzone { response.deadzone }
+        , rcpRange { 1.0f / std::max(response.saturation - response.deadzone, std::numeric_limits<float>::epsilon()) }
+        , curve { response.curve }
+    {
+    }
+
+    float deadzone { };
+    float rcpRange { };
+    float curve { };
+};
+
+inline float apply_response(const ResponseParameters& parameters, float magnitude)
+{
+    auto scaled = get_min(get_max((magnitude - parameters.deadzone) * parameters.rcpRange, 0), 1);
+    return scaled + parameters.curve * (scaled * scaled * scaled - scaled);
+}
+
+inline void process_stick(const Gamepad::Response& response, float* pX, float* pY)
+{
+    assert(pX);
+    assert(pY);
+    const ResponseParameters parameters(response);
+    alignas(64) std::array<float, Gamepad::Capacity> magnitudes;
+    for (size_t i = 0; i < Gamepad::Capacity; ++i) {
+        magnitudes[i] = pX[i] * pX[i] + pY[i] * pY[i];
+    }
+    for (size_t i = 0; i < Gamepad::Capacity; ++i) {
+        magnitudes[i] = std::sqrt(magnitudes[i]);
+    }
+    for (size_t i = 0; i < Gamepad::Capacity; ++i) {
+        auto magnitude = get_max(magnitudes[i], std::numeric_limits<float>::epsilon());
+        auto scale = apply_response(parameters, magnitude) / magnitude;
+        pX[i] *= scale;
+        pY[i] *= scale;
+    }
+}
+
+inline void process_trigger(const Gamepad::Response& response, float* pTrigger)
+{
+    assert(pTrigger);
+    const ResponseParameters parameters(response);
+    for (size_t i = 0; i < Gamepad::Capacity; ++i) {
+        pTrigger[i] = apply_response(parameters, pTrigger[i]);
+    }
+}
+
+} // namespace
+
+void Gamepad::State::reset()
+{
+    for (auto& values : axes) {
+        values.fill(0);
+    }
+    buttons.reset();
+    connected.reset();
+}
+
+void Gamepad::VirtualSource::set_connected(size_t index, bool connected)
+{
+    assert(index < Capacity);
+    mState.connected.set(index, connected);
+    if (!connected) {
+        for (auto& values : mState.axes) {
+            values[index] = 0;
+        }
+        for (int button_i = 0; button_i < (int)Button::Count; ++button_i) {
+            mState.buttons.reset(get_bit_index(index, (Button)button_i));
+        }
+    }
+}
+
+void Gamepad::VirtualSource::set(size_t index, Button button, bool down)
+{
+    assert(index < Capacity);
+    assert(mState.connected[index] || !down);
+    mState.buttons.set(get_bit_index(index, button), down);
+}
+
+void Gamepad::VirtualSource::set(size_t index, Axis axis, float value)
+{
+    assert(index < Capacity);
+    assert((int)axis < (int)Axis::Count);
+    assert(mState.connected[index] || !value);
+    mState.axes[(int)axis][index] = value;
+}
+
+void Gamepad::VirtualSource::poll(State* pState)
+{
+    assert(pState);
+    *pState = mState;
+}
+
+size_t Gamepad::get_bit_index(size_t index, Button button)
+{
+    assert(index < Capacity);
+    assert((int)button < (int)Button::Count);
+    return (size_t)button * Capacity + index;
+}
+
+void Gamepad::process(const Response& stickResponse, const Response& triggerResponse, State* pState)
+{
+    assert(pState);
+    auto& axes = pState->axes;
+    process_stick(stickResponse, axes[(int)Axis::LeftX].data(), axes[(int)Axis::LeftY].data());
+    process_stick(stickResponse, axes[(int)Axis::RightX].data(), axes[(int)Axis::RightY].data());
+    process_trigger(triggerResponse, axes[(int)Axis::LeftTrigger].data());
+    process_trigger(triggerResponse, axes[(int)Axis::RightTrigger].data());
+}
+
+bool Gamepad::connected(size_t index) const
+{
+    assert(index < Capacity);
+    return current.connected[index];
+}
+
+bool Gamepad::up(size_t index, Button button) const
+{
+    return !current.buttons[get_bit_index(index, button)];
+}
+
+bool Gamepad::down(size_t index, Button button) const
+{
+    return current.buttons[get_bit_index(index, button)];
+}
+
+bool Gamepad::held(size_t index, Button button) const
+{
+    auto bit_i = get_bit_index(index, button);
+    return previous.buttons[bit_i] && current.buttons[bit_i];
+}
+
+bool Gamepad::pressed(size_t index, Button button) const
+{
+    auto bit_i = get_bit_index(index, button);
+    return !previous.buttons[bit_i] && current.buttons[bit_i];
+}
+
+bool Gamepad::released(size_t index, Button button) const
+{
+    auto bit_i = get_bit_index(index, button);
+    return previous.buttons[bit_i] && !current.buttons[bit_i];
+}
+
+float Gamepad::axis(size_t index, Axis axis) const
+{
+    assert(index < Capacity);
+    assert((int)axis < (int)Axis::Count);
+    return current.axes[(int)axis][index];
+}
+
+const Gamepad::Buttons& Gamepad::down_buttons() const
+{
+    return current.buttons;
+}
+
+Gamepad::Buttons Gamepad::pressed_buttons() const
+{
+    return ~previous.buttons & current.buttons;
+}
+
+Gamepad::Buttons Gamepad::released_buttons() const
+{
+    return previous.buttons & ~current.buttons;
+}
+
+void Gamepad::stage_connection(size_t index, bool connected)
+{
+    assert(index < Capacity);
+    staged.connected.set(index, connected);
+}
+
+void Gamepad::stage(size_t index, Button button, bool down)
+{
+    staged.buttons.set(get_bit_index(index, button), down);
+}
+
+void Gamepad::stage(size_t index, Axis axis, float value)
+{
+    assert(index < Capacity);
+    assert((int)axis < (int)Axis::Count);
+    staged.axes[(int)axis][index] = value;
+}
+
+void Gamepad::update()
+{
+    previous = current;
+    current = staged;
+}
+
+void Gamepad::reset()
+{
+    previous.reset();
+    current.reset();
+    staged.reset();
+}
+
+} // namespace sys
+} // namespace dst
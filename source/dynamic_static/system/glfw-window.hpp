@@ -11,6 +11,7 @@
 #pragma once
 
 #include "dynamic_static/system/window.hpp"
+#include "dynamic_static/system/allocation-tracker.hpp"
 
 #include "GLFW/glfw3.h"
 #ifdef DYNAMIC_STATIC_PLATFORM_WINDOWS
@@ -28,12 +29,175 @@
 #endif
 #include "GLFW/glfw3native.h"
 
+#include <algorithm>
 #include <iostream>
 #include <stdexcept>
 
 namespace dst {
 namespace sys {
 
+template <typename FunctionType>
+void Window::process_events(FunctionType getGlfwWaitTimeout)
+{
+    // NOTE : Callbacks are collected while the Registry is locked and dispatched
+    //  after it's unlocked so that user handlers are free to create and destroy
+    //  Windows or to process events reentrantly.  Each invocation only dispatches
+    //  the range of Callbacks that it collected.
+    //  Child Windows are processed by their parent rather than individually.
+    thread_local std::vector<Callback> tlCallbacks;
+    AllocationTracker::begin_frame();
+    dst_allocation_scope("sys::Window::poll_events");
+    auto callbacksBegin = tlCallbacks.size();
+    auto begin = dst::HighResolutionClock::now();
+    bool glfwWindows = false;
+    bool glfwWait = false;
+    double glfwWaitTimeout = 0;
+    access_registry(
+        [&](Registry& registry)
+        {
+            for (auto pWindow : registry.get_windows()) {
+                if (!pWindow->mpParent) {
+                    pWindow->begin_processing_events();
+                }
+            }
+            glfwWindows = has_glfw_windows(registry);
+            glfwWait = glfwWindows && getGlfwWaitTimeout(registry, &glfwWaitTimeout);
+            if (glfwWait && (sGamepadSource || sGamepadState.connected.any())) {
+                // NOTE : Gamepads don't generate GLFW events, they're polled
+                //  after the wait returns so it's bounded while any may change.
+                if (!(0 < glfwWaitTimeout) || GamepadWaitTimeout < glfwWaitTimeout) {
+                    glfwWaitTimeout = GamepadWaitTimeout;
+                }
+            }
+        }
+    );
+    // NOTE : The Registry is unlocked while blocked in GLFW so that other threads
+    //  are free to create and destroy Windows during the wait.  GLFW Windows are
+    //  only created and destroyed on the main thread so the GLFW callbacks fired
+    //  during the wait can't race with their Window being destroyed.
+    if (glfwWait) {
+        if (0 < glfwWaitTimeout) {
+            glfwWaitEventsTimeout(glfwWaitTimeout);
+        } else {
+            glfwWaitEvents();
+        }
+    }
+    access_registry(
+        [&](Registry& registry)
+        {
+            if (has_glfw_windows(registry)) {
+                glfwPollEvents();
+            }
+            poll_gamepads();
+            auto seconds = dst::duration_cast<dst::Seconds<double>>(dst::HighResolutionClock::now() - begin).count();
+            for (auto pWindow : registry.get_windows()) {
+                if (!pWindow->mpParent) {
+                    pWindow->end_processing_events(seconds, &tlCallbacks);
+                }
+            }
+        }
+    );
+    auto callbacksEnd = tlCallbacks.size();
+    for (auto callback_i = callbacksBegin; callback_i < callbacksEnd; ++callback_i) {
+        auto callback = tlCallbacks[callback_i];
+        Window* pWindow = nullptr;
+        access_registry(
+            [&](const Registry& registry)
+            {
+                pWindow = registry.get(callback.handle);
+            }
+        );
+        if (pWindow) {
+            switch (callback.type) {
+            case Callback::Type::Resize: pWindow->on_resize(*pWindow); break;
+            case Callback::Type::ResizeSettled: pWindow->on_resize_settled(*pWindow); break;
+            case Callback::Type::CloseRequested: pWindow->on_close_requested(*pWindow); break;
+            default: assert(false); break;
+            }
+        }
+    }
+    tlCallbacks.resize(callbacksBegin);
+}
+
+void Window::begin_processing_events()
+{
+    mTextStream.clear();
+    mFrameAllocator.reset();
+    for (auto& child : mChildren) {
+        child->begin_processing_events();
+    }
+}
+
+void Window::end_processing_events(double pollSeconds, std::vector<Callback>* pCallbacks)
+{
+    assert(pCallbacks);
+    stage_gamepad_events(sGamepadState);
+    thread_local std::vector<Input::Event> tlReplayEvents;
+    if (mInputReplayer.read_frame(&tlReplayEvents)) {
+        for (const auto& event : tlReplayEvents) {
+            process_event(event);
+        }
+    }
+    mInputRecorder.end_frame();
+    mFrameStats.record(FrameStats::Phase::PollEvents, pollSeconds);
+    mInput.update();
+    mLatencyPending = !mInput.get_events().empty() && !mInputReplayer.is_open();
+    if (mResized) {
+        pCallbacks->push_back({ Callback::Type::Resize, mHandle });
+        mResized = false;
+        mResizeSettling = true;
+        mResizeTimePoint = dst::HighResolutionClock::now();
+    }
+    if (mResizeSettling && mInfo.resizeSettleTime <= get_resize_settle_elapsed()) {
+        pCallbacks->push_back({ Callback::Type::ResizeSettled, mHandle });
+        mResizeSettling = false;
+    }
+    if (mCloseRequested) {
+        pCallbacks->push_back({ Callback::Type::CloseRequested, mHandle });
+        mCloseRequested = false;
+    }
+    for (auto& child : mChildren) {
+        child->end_processing_events(pollSeconds, pCallbacks);
+    }
+}
+
+bool Window::get_background_wait_timeout(const Registry& registry, double* pTimeout)
+{
+    assert(pTimeout);
+    *pTimeout = 0;
+    for (auto pWindow : registry.get_windows()) {
+        if (!(int)(pWindow->mInfo.flags & Info::Flags::ThrottleBackground) || !pWindow->is_background() || pWindow->mInputReplayer.is_open()) {
+            return false;
+        }
+        auto timeout = pWindow->mInfo.backgroundWaitTimeout;
+        if (pWindow->mResizeSettling) {
+            // NOTE : Don't wait past a pending resize settle or it won't be
+            //  fired until another event arrives.
+            auto settleTimeout = std::max(pWindow->mInfo.resizeSettleTime - pWindow->get_resize_settle_elapsed(), 0.001);
+            timeout = 0 < timeout ? std::min(timeout, settleTimeout) : settleTimeout;
+        }
+        if (0 < timeout && (!*pTimeout || timeout < *pTimeout)) {
+            *pTimeout = timeout;
+        }
+    }
+    return !registry.empty();
+}
+
+double Window::get_resize_settle_elapsed() const
+{
+    return dst::duration_cast<dst::Seconds<double>>(dst::HighResolutionClock::now() - mResizeTimePoint).count();
+}
+
+bool Window::has_glfw_windows(const Registry& registry)
+{
+    for (auto pWindow : registry.get_windows()) {
+        if (pWindow->mGlfwWindow) {
+            return true;
+        }
+    }
+    return false;
+}
+
 std::string& Window::get_last_glfw_error_message()
 {
     thread_local std::string tlGlfwErrorMessage;
@@ -52,7 +216,21 @@ void Window::glfw_window_close_callback(GLFWwindow* pGlfwWindow)
 {
     auto pDstWindow = (Window*)glfwGetWindowUserPointer(pGlfwWindow);
     assert(pDstWindow);
-    pDstWindow->on_close_requested(*pDstWindow);
+    pDstWindow->mCloseRequested = true;
+}
+
+void Window::glfw_window_iconify_callback(GLFWwindow* pGlfwWindow, int iconified)
+{
+    auto pDstWindow = (Window*)glfwGetWindowUserPointer(pGlfwWindow);
+    assert(pDstWindow);
+    pDstWindow->mIconified = iconified == GLFW_TRUE;
+}
+
+void Window::glfw_window_focus_callback(GLFWwindow* pGlfwWindow, int focused)
+{
+    auto pDstWindow = (Window*)glfwGetWindowUserPointer(pGlfwWindow);
+    assert(pDstWindow);
+    pDstWindow->mFocused = focused == GLFW_TRUE;
 }
 
 void Window::glfw_framebuffer_size_callback(GLFWwindow* pGlfwWindow, int width, int height)
@@ -62,9 +240,11 @@ void Window::glfw_framebuffer_size_callback(GLFWwindow* pGlfwWindow, int width,
     (void)height;
     auto pDstWindow = (Window*)glfwGetWindowUserPointer(pGlfwWindow);
     assert(pDstWindow);
-    pDstWindow->mInfo.extent.x = width;
-    pDstWindow->mInfo.extent.y = height;
-    pDstWindow->on_resize(*pDstWindow);
+    Input::Event event { };
+    event.type = Input::Event::Type::Resize;
+    event.value = { (double)width, (double)height };
+    event.timestamp = dst::HighResolutionClock::now();
+    pDstWindow->process_glfw_event(event);
 }
 
 void Window::glfw_keyboard_callback(GLFWwindow* pGlfwWindow, int key, int scancode, int action, int mods)
@@ -75,21 +255,29 @@ void Window::glfw_keyboard_callback(GLFWwindow* pGlfwWindow, int key, int scanco
     (void)mods;
     auto pDstWindow = (Window*)glfwGetWindowUserPointer(pGlfwWindow);
     assert(pDstWindow);
-    auto dstKey = (int)glfw_to_dst_key(key);
+    Input::Event event { };
+    event.type = Input::Event::Type::Key;
+    event.code = (uint32_t)glfw_to_dst_key(key);
+    event.timestamp = dst::HighResolutionClock::now();
     switch (action) {
-    case GLFW_PRESS: pDstWindow->mInput.keyboard.staged[dstKey] = ButtonDown; break;
-    case GLFW_RELEASE: pDstWindow->mInput.keyboard.staged[dstKey] = ButtonUp; break;
-    case GLFW_REPEAT: pDstWindow->mInput.keyboard.staged[dstKey] = ButtonDown; break;
-    default:break;
+    case GLFW_PRESS: event.action = Input::Event::Action::Press; break;
+    case GLFW_RELEASE: event.action = Input::Event::Action::Release; break;
+    case GLFW_REPEAT: event.action = Input::Event::Action::Repeat; break;
+    default: return;
     }
+    pDstWindow->process_glfw_event(event);
 }
 
 void Window::glfw_char_callback(GLFWwindow* pGlfwWindow, unsigned int codepoint)
 {
     auto pDstWindow = (Window*)glfwGetWindowUserPointer(pGlfwWindow);
     assert(pDstWindow);
-    if (codepoint > 0 && codepoint < 0x10000) {
-        pDstWindow->mTextStream.push_back((uint32_t)codepoint);
+    if (codepoint) {
+        Input::Event event { };
+        event.type = Input::Event::Type::Text;
+        event.code = (uint32_t)codepoint;
+        event.timestamp = dst::HighResolutionClock::now();
+        pDstWindow->process_glfw_event(event);
     }
 }
 
@@ -97,7 +285,11 @@ void Window::glfw_mouse_position_callback(GLFWwindow* pGlfwWindow, double xOffse
 {
     auto pDstWindow = (Window*)glfwGetWindowUserPointer(pGlfwWindow);
     assert(pDstWindow);
-    pDstWindow->mInput.mouse.staged.position = { xOffset, yOffset };
+    Input::Event event { };
+    event.type = Input::Event::Type::MousePosition;
+    event.value = { xOffset, yOffset };
+    event.timestamp = dst::HighResolutionClock::now();
+    pDstWindow->process_glfw_event(event);
 }
 
 void Window::glfw_mouse_button_callback(GLFWwindow* pGlfwWindow, int button, int action, int mods)
@@ -105,99 +297,145 @@ void Window::glfw_mouse_button_callback(GLFWwindow* pGlfwWindow, int button, int
     (void)mods;
     auto pDstWindow = (Window*)glfwGetWindowUserPointer(pGlfwWindow);
     assert(pDstWindow);
-    auto dstButton = (int)glfw_to_dst_mouse_button(button);
+    Input::Event event { };
+    event.type = Input::Event::Type::MouseButton;
+    event.code = (uint32_t)glfw_to_dst_mouse_button(button);
+    event.timestamp = dst::HighResolutionClock::now();
     switch (action) {
-    case GLFW_PRESS: pDstWindow->mInput.mouse.staged.buttons[dstButton] = ButtonDown; break;
-    case GLFW_RELEASE: pDstWindow->mInput.mouse.staged.buttons[dstButton] = ButtonUp; break;
-    case GLFW_REPEAT: pDstWindow->mInput.mouse.staged.buttons[dstButton] = ButtonDown; break;
-    default:break;
+    case GLFW_PRESS: event.action = Input::Event::Action::Press; break;
+    case GLFW_RELEASE: event.action = Input::Event::Action::Release; break;
+    case GLFW_REPEAT: event.action = Input::Event::Action::Repeat; break;
+    default: return;
     }
+    pDstWindow->process_glfw_event(event);
 }
 
 void Window::glfw_mouse_scroll_callback(GLFWwindow* pGlfwWindow, double xOffset, double yOffset)
 {
     auto pDstWindow = (Window*)glfwGetWindowUserPointer(pGlfwWindow);
     assert(pDstWindow);
-    pDstWindow->mInput.mouse.staged.scroll += (float)yOffset;
+    Input::Event event { };
+    event.type = Input::Event::Type::MouseScroll;
+    event.value = { xOffset, yOffset };
+    event.timestamp = dst::HighResolutionClock::now();
+    pDstWindow->process_glfw_event(event);
 }
 
-GLFWwindow* Window::create_glfw_window(const Info& info)
+void Window::poll_glfw_gamepads(Gamepad::State* pState)
 {
-    GLFWwindow* pGlfwWindow = nullptr;
-    access_glfw_windows(
-        [&](std::set<GLFWwindow*>& glfwWindows)
-        {
-            if (glfwWindows.empty()) {
-                glfwSetErrorCallback(glfw_error_callback);
-                if (glfwInit() == GLFW_FALSE) {
-                    throw std::runtime_error("Failed to initialize GLFW : " + get_last_glfw_error_message());
-                }
-                #ifdef DYNAMIC_STATIC_SYSTEM_OPENGL_ENABLED
-                if (info.pGlInfo) {
-                    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, info.pGlInfo->version.major);
-                    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, info.pGlInfo->version.minor);
-                    glfwWindowHint(GLFW_DOUBLEBUFFER, (int)(info.pGlInfo->flags & Window::GlInfo::Flags::DoubleBuffer) ? 1 : 0);
-                    glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, true);
-                } else
-                #endif // DYNAMIC_STATIC_SYSTEM_OPENGL_ENABLED
-                    glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
+    static_assert(GLFW_JOYSTICK_LAST + 1 == Gamepad::Capacity, "Gamepad::Capacity must match the number of GLFW joysticks");
+    static_assert(GLFW_GAMEPAD_BUTTON_LAST + 1 == (int)Gamepad::Button::Count, "Gamepad::Button must match GLFW's gamepad buttons");
+    static_assert(GLFW_GAMEPAD_AXIS_LAST + 1 == (int)Gamepad::Axis::Count, "Gamepad::Axis must match GLFW's gamepad axes");
+    assert(pState);
+    pState->reset();
+    for (int gamepad_i = 0; gamepad_i < (int)Gamepad::Capacity; ++gamepad_i) {
+        GLFWgamepadstate glfwGamepadState { };
+        if (glfwJoystickIsGamepad(gamepad_i) && glfwGetGamepadState(gamepad_i, &glfwGamepadState)) {
+            pState->connected.set(gamepad_i);
+            for (int button_i = 0; button_i < (int)Gamepad::Button::Count; ++button_i) {
+                pState->buttons.set(Gamepad::get_bit_index(gamepad_i, (Gamepad::Button)button_i), glfwGamepadState.buttons[button_i] == GLFW_PRESS);
             }
-            glfwWindowHint(GLFW_DECORATED, (int)(info.flags & Window::Info::Flags::Decorated) ? 1 : 0);
-            glfwWindowHint(GLFW_RESIZABLE, (int)(info.flags & Window::Info::Flags::Resizable) ? 1 : 0);
-            glfwWindowHint(GLFW_VISIBLE, (int)(info.flags & Window::Info::Flags::Visible) ? 1 : 0);
-            pGlfwWindow = glfwCreateWindow(
-                info.extent.x,
-                info.extent.y,
-                info.pName,
-                (int)(info.flags & Window::Info::Flags::Fullscreen) ? glfwGetPrimaryMonitor() : nullptr,
-                nullptr
-            );
-            if (!pGlfwWindow) {
-                auto errorMessage = get_last_glfw_error_message();
-                if (glfwWindows.empty()) {
-                    glfwTerminate();
-                }
-                throw std::runtime_error("Failed to create GLFW window : " + errorMessage);
+            for (int axis_i = 0; axis_i < (int)Gamepad::Axis::Count; ++axis_i) {
+                pState->axes[axis_i][gamepad_i] = glfwGamepadState.axes[axis_i];
             }
-            #ifdef DYNAMIC_STATIC_SYSTEM_OPENGL_ENABLED
-            if (info.pGlInfo) {
-                glfwMakeContextCurrent(pGlfwWindow);
-                // glfwSwapInterval((int)(info.pGlInfo->flags & gl::Context::Info::Flags::VSync) ? 1 : 0);
-                #ifdef DYNAMIC_STATIC_PLATFORM_WINDOWS
-                if (!gl::initialize_glew()) {
-                    destroy_glfw_window(pGlfwWindow);
-                    throw std::runtime_error("Failed to initialize GLEW");
-                }
-                #endif // DYNAMIC_STATIC_PLATFORM_WINDOWS
+            // NOTE : GLFW reports triggers from -1 to 1, Gamepad::Source expects 0 to 1.
+            for (auto axis : { Gamepad::Axis::LeftTrigger, Gamepad::Axis::RightTrigger }) {
+                auto& value = pState->axes[(int)axis][gamepad_i];
+                value = (value + 1) * 0.5f;
             }
-            #endif // DYNAMIC_STATIC_SYSTEM_OPENGL_ENABLED
-            glfwSetWindowCloseCallback(pGlfwWindow, glfw_window_close_callback);
-            glfwSetFramebufferSizeCallback(pGlfwWindow, glfw_framebuffer_size_callback);
-            glfwSetKeyCallback(pGlfwWindow, glfw_keyboard_callback);
-            glfwSetCharCallback(pGlfwWindow, glfw_char_callback);
-            glfwSetCursorPosCallback(pGlfwWindow, glfw_mouse_position_callback);
-            glfwSetMouseButtonCallback(pGlfwWindow, glfw_mouse_button_callback);
-            glfwSetScrollCallback(pGlfwWindow, glfw_mouse_scroll_callback);
-            glfwWindows.insert(pGlfwWindow);
         }
-    );
-    return pGlfwWindow;
+    }
 }
 
-void Window::destroy_glfw_window(GLFWwindow* pGlfwWindow)
+void Window::acquire_glfw()
 {
-    access_glfw_windows(
-        [&](std::set<GLFWwindow*>& glfwWindows)
-        {
-            if (pGlfwWindow) {
-                glfwDestroyWindow(pGlfwWindow);
-            }
-            glfwWindows.erase(pGlfwWindow);
-            if (glfwWindows.empty()) {
-                glfwTerminate();
-            }
+    if (!sGlfwReferenceCount) {
+        glfwSetErrorCallback(glfw_error_callback);
+        if (glfwInit() == GLFW_FALSE) {
+            throw std::runtime_error("Failed to initialize GLFW : " + get_last_glfw_error_message());
+        }
+    }
+    ++sGlfwReferenceCount;
+}
+
+void Window::release_glfw()
+{
+    assert(sGlfwReferenceCount);
+    if (!--sGlfwReferenceCount) {
+        glfwTerminate();
+    }
+}
+
+GLFWwindow* Window::create_glfw_window(const Registry& registry, const Info& info)
+{
+    // NOTE : Info is validated before GLFW is acquired so that a failed
+    //  validation doesn't leave a GLFW reference behind.
+    GLFWwindow* pShareGlfwWindow = nullptr;
+    #ifdef DYNAMIC_STATIC_SYSTEM_OPENGL_ENABLED
+    if (info.pGlInfo && info.pShareWindow) {
+        pShareGlfwWindow = info.pShareWindow->mGlfwWindow;
+        if (!pShareGlfwWindow) {
+            throw std::runtime_error("Failed to create GLFW window : Window::Info::pShareWindow must have an OpenGL context created by GLFW");
         }
+    }
+    #endif // DYNAMIC_STATIC_SYSTEM_OPENGL_ENABLED
+    acquire_glfw();
+    // NOTE : GLFW may already be initialized by a System or another Window so
+    //  client API hints are set for every GLFWwindow rather than once at init.
+    #ifdef DYNAMIC_STATIC_SYSTEM_OPENGL_ENABLED
+    if (info.pGlInfo) {
+        glfwWindowHint(GLFW_CLIENT_API, GLFW_OPENGL_API);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, info.pGlInfo->version.major);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, info.pGlInfo->version.minor);
+        glfwWindowHint(GLFW_DOUBLEBUFFER, (int)(info.pGlInfo->flags & Window::GlInfo::Flags::DoubleBuffer) ? 1 : 0);
+        glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, true);
+    } else
+    #endif // DYNAMIC_STATIC_SYSTEM_OPENGL_ENABLED
+        glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
+    glfwWindowHint(GLFW_DECORATED, (int)(info.flags & Window::Info::Flags::Decorated) ? 1 : 0);
+    glfwWindowHint(GLFW_RESIZABLE, (int)(info.flags & Window::Info::Flags::Resizable) ? 1 : 0);
+    glfwWindowHint(GLFW_VISIBLE, (int)(info.flags & Window::Info::Flags::Visible) ? 1 : 0);
+    auto pGlfwWindow = glfwCreateWindow(
+        info.extent.x,
+        info.extent.y,
+        info.pName,
+        (int)(info.flags & Window::Info::Flags::Fullscreen) ? glfwGetPrimaryMonitor() : nullptr,
+        pShareGlfwWindow
     );
+    if (!pGlfwWindow) {
+        auto errorMessage = get_last_glfw_error_message();
+        release_glfw();
+        throw std::runtime_error("Failed to create GLFW window : " + errorMessage);
+    }
+    #ifdef DYNAMIC_STATIC_SYSTEM_OPENGL_ENABLED
+    if (info.pGlInfo) {
+        glfwMakeContextCurrent(pGlfwWindow);
+        #ifdef DYNAMIC_STATIC_PLATFORM_WINDOWS
+        if (!gl::initialize_glew()) {
+            destroy_glfw_window(registry, pGlfwWindow);
+            throw std::runtime_error("Failed to initialize GLEW");
+        }
+        #endif // DYNAMIC_STATIC_PLATFORM_WINDOWS
+    }
+    #endif // DYNAMIC_STATIC_SYSTEM_OPENGL_ENABLED
+    glfwSetWindowCloseCallback(pGlfwWindow, glfw_window_close_callback);
+    glfwSetWindowIconifyCallback(pGlfwWindow, glfw_window_iconify_callback);
+    glfwSetWindowFocusCallback(pGlfwWindow, glfw_window_focus_callback);
+    glfwSetFramebufferSizeCallback(pGlfwWindow, glfw_framebuffer_size_callback);
+    glfwSetKeyCallback(pGlfwWindow, glfw_keyboard_callback);
+    glfwSetCharCallback(pGlfwWindow, glfw_char_callback);
+    glfwSetCursorPosCallback(pGlfwWindow, glfw_mouse_position_callback);
+    glfwSetMouseButtonCallback(pGlfwWindow, glfw_mouse_button_callback);
+    glfwSetScrollCallback(pGlfwWindow, glfw_mouse_scroll_callback);
+    return pGlfwWindow;
+}
+
+void Window::destroy_glfw_window(const Registry& registry, GLFWwindow* pGlfwWindow)
+{
+    if (pGlfwWindow) {
+        glfwDestroyWindow(pGlfwWindow);
+        release_glfw();
+    }
 }
 
 Keyboard::Key Window::glfw_to_dst_key(int glfwKey)
@@ -9,13 +9,16 @@
 */
 
 #include "dynamic_static/system/gui.hpp"
+#include "dynamic_static/system/allocation-tracker.hpp"
+
+#include <algorithm>
 
 namespace dst {
 namespace sys {
 
-Gui::Gui()
+Gui::Gui(ImFontAtlas* pFontAtlas)
 {
-    ImGui::CreateContext();
+    ImGui::CreateContext(pFontAtlas);
     auto& io = ImGui::GetIO();
     io.KeyMap[ImGuiKey_Tab]        = (int)Keyboard::Key::Tab;
     io.KeyMap[ImGuiKey_LeftArrow]  = (int)Keyboard::Key::LeftArrow;
@@ -47,6 +50,7 @@ Gui::~Gui()
 
 void Gui::begin_frame(const Clock& clock, Window& window)
 {
+    dst_allocation_scope("sys::Gui::begin_frame");
     const auto& input = window.get_input();
     auto& io = ImGui::GetIO();
     auto resolution = window.get_info().extent;
@@ -56,16 +60,17 @@ void Gui::begin_frame(const Clock& clock, Window& window)
     io.DeltaTime = clock.elapsed<dst::Seconds<float>>();
     io.MousePos.x = input.mouse.current.position.x;
     io.MousePos.y = input.mouse.current.position.y;
-    io.MouseDown[0] = input.mouse.down(Mouse::Button::Left);
-    io.MouseDown[1] = input.mouse.down(Mouse::Button::Right);
-    io.MouseDown[2] = input.mouse.down(Mouse::Button::Middle);
+    // NOTE : Buttons pressed and released within a single frame are reported as
+    //  down for that frame so that ImGui doesn't miss clicks during long frames.
+    io.MouseDown[0] = input.mouse.down(Mouse::Button::Left) || input.mouse.pressed(Mouse::Button::Left);
+    io.MouseDown[1] = input.mouse.down(Mouse::Button::Right) || input.mouse.pressed(Mouse::Button::Right);
+    io.MouseDown[2] = input.mouse.down(Mouse::Button::Middle) || input.mouse.pressed(Mouse::Button::Middle);
     io.MouseWheel += (float)input.mouse.scroll_delta();
-    for (int i = 0; i < (int)Keyboard::Key::Count; ++i) {
-        io.KeysDown[i] = input.keyboard.down((Keyboard::Key)i);
-    }
-    for (auto codepoint : window.get_text_stream()) {
-        io.AddInputCharacter((ImWchar)codepoint);
+    std::fill_n(io.KeysDown, (int)Keyboard::Key::Count, false);
+    for (auto key : input.keyboard.down_keys()) {
+        io.KeysDown[key] = true;
     }
+    io.AddInputCharactersUTF8(window.get_text_stream().get_utf8());
     io.KeyAlt = input.keyboard.down(Keyboard::Key::Alt);
     io.KeyCtrl =
         input.keyboard.down(Keyboard::Key::LeftControl) ||
@@ -0,0 +1,252 @@
+
+/*
+==========================================
+  Copyright (c) 2020 Dynamic_Static
+    Patrick Purcell
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#include "dynamic_static/system/input-history.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+namespace dst {
+namespace sys {
+namespace {
+
+inline double get_seconds(dst::TimePoint<> begin, dst::TimePoint<> end)
+{
+    return dst::duration_cast<dst::Seconds<double>>(end - begin).count();
+}
+
+template <typename BitSetType, typename CountsType>
+inline BitSetType get_repressed(const BitSetType& pressMask, const CountsType& pressCounts)
+{
+    BitSetType repressed { };
+    for (auto i : pressMask) {
+        repressed.set(i, 1 < pressCounts[i]);
+    }
+    return repressed;
+}
+
+template <typename BitSetType>
+inline bool double_tapped(
+    const InputHistory& history,
+    BitSetType InputHistory::Frame::* pPressed,
+    BitSetType InputHistory::Frame::* pRepressed,
+    size_t index,
+    double interval
+)
+{
+    if (history.size()) {
+        const auto& newest = history.get_frame(0);
+        if ((newest.*pPressed)[index]) {
+            if (pRepressed && (newest.*pRepressed)[index]) {
+                return true;
+            }
+            for (size_t age = 1; age < history.size(); ++age) {
+                const auto& frame = history.get_frame(age);
+                if (interval < get_seconds(frame.timestamp, newest.timestamp)) {
+                    break;
+                }
+                if ((frame.*pPressed)[index]) {
+                    return true;
+                }
+            }
+        }
+    }
+    return false;
+}
+
+template <typename BitSetType>
+inline double get_held_time(
+    const InputHistory& history,
+    BitSetType InputHistory::Frame::* pDown,
+    size_t index,
+    dst::TimePoint<> pressTimestamp
+)
+{
+    if (history.size()) {
+        const auto& newest = history.get_frame(0);
+        if ((newest.*pDown)[index]) {
+            return get_seconds(pressTimestamp, newest.timestamp);
+        }
+    }
+    return 0;
+}
+
+template <typename BitSetType>
+inline bool long_pressed(
+    const InputHistory& history,
+    BitSetType InputHistory::Frame::* pDown,
+    size_t index,
+    dst::TimePoint<> pressTimestamp,
+    double duration
+)
+{
+    if (history.size()) {
+        const auto& newest = history.get_frame(0);
+        if ((newest.*pDown)[index] && duration <= get_seconds(pressTimestamp, newest.timestamp)) {
+            // NOTE : The press is long if the duration was reached in the newest
+            //  Frame, ie. the previous Frame was recorded before the press or
+            //  before the duration elapsed.
+            if (history.size() == 1) {
+                return true;
+            }
+            const auto& previous = history.get_frame(1);
+            return previous.timestamp < pressTimestamp || get_seconds(pressTimestamp, previous.timestamp) < duration;
+        }
+    }
+    return false;
+}
+
+template <typename BitSetType, typename TimestampsType>
+inline void rewind_press_timestamps(
+    const InputHistory& history,
+    BitSetType InputHistory::Frame::* pDown,
+    BitSetType InputHistory::Frame::* pPressed,
+    TimestampsType& pressTimestamps
+)
+{
+    // NOTE : Inputs that are down in the newest remaining Frame but have a press
+    //  timestamp newer than it were released and pressed again in the discarded
+    //  Frames, their original press is found by scanning back through the ring.
+    const auto& newest = history.get_frame(0);
+    for (auto i : newest.*pDown) {
+        if (newest.timestamp < pressTimestamps[i]) {
+            auto age = history.size() - 1;
+            for (size_t frame_i = 0; frame_i < history.size(); ++frame_i) {
+                const auto& frame = history.get_frame(frame_i);
+                if ((frame.*pPressed)[i] || !(frame.*pDown)[i]) {
+                    age = (frame.*pDown)[i] ? frame_i : frame_i - 1;
+                    break;
+                }
+            }
+            pressTimestamps[i] = history.get_frame(age).timestamp;
+        }
+    }
+}
+
+} // namespace
+
+void InputHistory::advance(const Keyboard& keyboard, const Mouse& mouse, const Gamepad& gamepad, dst::TimePoint<> timestamp)
+{
+    mNewest = (mNewest + 1) & (Capacity - 1);
+    mSize = std::min(mSize + 1, Capacity);
+    auto& frame = mFrames[mNewest];
+    frame.keys = keyboard.down_keys();
+    frame.pressedKeys = keyboard.pressed_keys();
+    frame.repressedKeys = get_repressed(keyboard.pressMask, keyboard.pressCounts);
+    frame.buttons = mouse.down_buttons();
+    frame.pressedButtons = mouse.pressed_buttons();
+    frame.repressedButtons = get_repressed(mouse.pressMask, mouse.pressCounts);
+    frame.gamepadButtons = gamepad.down_buttons();
+    frame.pressedGamepadButtons = gamepad.pressed_buttons();
+    frame.position = mouse.current.position;
+    frame.motion = mouse.current.motion;
+    frame.scroll = mouse.current.scroll;
+    frame.timestamp = timestamp;
+    for (auto key_i : frame.pressedKeys) {
+        mKeyPressTimestamps[key_i] = timestamp;
+    }
+    for (auto button_i : frame.pressedButtons) {
+        mButtonPressTimestamps[button_i] = timestamp;
+    }
+    for (auto button_i : frame.pressedGamepadButtons) {
+        mGamepadButtonPressTimestamps[button_i] = timestamp;
+    }
+}
+
+void InputHistory::rewind(size_t frameCount)
+{
+    frameCount = std::min(frameCount, mSize);
+    mNewest = (mNewest + Capacity - frameCount) & (Capacity - 1);
+    mSize -= frameCount;
+    if (mSize) {
+        rewind_press_timestamps(*this, &Frame::keys, &Frame::pressedKeys, mKeyPressTimestamps);
+        rewind_press_timestamps(*this, &Frame::buttons, &Frame::pressedButtons, mButtonPressTimestamps);
+        rewind_press_timestamps(*this, &Frame::gamepadButtons, &Frame::pressedGamepadButtons, mGamepadButtonPressTimestamps);
+    }
+}
+
+void InputHistory::reset()
+{
+    mNewest = Capacity - 1;
+    mSize = 0;
+    mKeyPressTimestamps.fill({ });
+    mButtonPressTimestamps.fill({ });
+    mGamepadButtonPressTimestamps.fill({ });
+}
+
+size_t InputHistory::size() const
+{
+    return mSize;
+}
+
+const InputHistory::Frame& InputHistory::get_frame(size_t age) const
+{
+    assert(age < mSize);
+    return mFrames[(mNewest + Capacity - age) & (Capacity - 1)];
+}
+
+bool InputHistory::double_tapped(Keyboard::Key key, double interval) const
+{
+    assert((int)key < (int)Keyboard::Key::Count);
+    return sys::double_tapped(*this, &Frame::pressedKeys, &Frame::repressedKeys, (size_t)key, interval);
+}
+
+bool InputHistory::double_tapped(Mouse::Button button, double interval) const
+{
+    assert((int)button < (int)Mouse::Button::Count);
+    return sys::double_tapped(*this, &Frame::pressedButtons, &Frame::repressedButtons, (size_t)button, interval);
+}
+
+bool InputHistory::double_tapped(size_t index, Gamepad::Button button, double interval) const
+{
+    // NOTE : Gamepads are polled once per frame so a Gamepad::Button can't be
+    //  pressed more than once in a single Frame.
+    Gamepad::Buttons Frame::* pRepressed = nullptr;
+    return sys::double_tapped(*this, &Frame::pressedGamepadButtons, pRepressed, Gamepad::get_bit_index(index, button), interval);
+}
+
+double InputHistory::get_held_time(Keyboard::Key key) const
+{
+    assert((int)key < (int)Keyboard::Key::Count);
+    return sys::get_held_time(*this, &Frame::keys, (size_t)key, mKeyPressTimestamps[(size_t)key]);
+}
+
+double InputHistory::get_held_time(Mouse::Button button) const
+{
+    assert((int)button < (int)Mouse::Button::Count);
+    return sys::get_held_time(*this, &Frame::buttons, (size_t)button, mButtonPressTimestamps[(size_t)button]);
+}
+
+double InputHistory::get_held_time(size_t index, Gamepad::Button button) const
+{
+    auto bit_i = Gamepad::get_bit_index(index, button);
+    return sys::get_held_time(*this, &Frame::gamepadButtons, bit_i, mGamepadButtonPressTimestamps[bit_i]);
+}
+
+bool InputHistory::long_pressed(Keyboard::Key key, double duration) const
+{
+    assert((int)key < (int)Keyboard::Key::Count);
+    return sys::long_pressed(*this, &Frame::keys, (size_t)key, mKeyPressTimestamps[(size_t)key], duration);
+}
+
+bool InputHistory::long_pressed(Mouse::Button button, double duration) const
+{
+    assert((int)button < (int)Mouse::Button::Count);
+    return sys::long_pressed(*this, &Frame::buttons, (size_t)button, mButtonPressTimestamps[(size_t)button], duration);
+}
+
+bool InputHistory::long_pressed(size_t index, Gamepad::Button button, double duration) const
+{
+    auto bit_i = Gamepad::get_bit_index(index, button);
+    return sys::long_pressed(*this, &Frame::gamepadButtons, bit_i, mGamepadButtonPressTimestamps[bit_i], duration);
+}
+
+} // namespace sys
+} // namespace dst
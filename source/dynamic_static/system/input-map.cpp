@@ -0,0 +1,250 @@
+
+/*
+==========================================
+  Copyright (c) 2020 Dynamic_Static
+    Patrick Purcell
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#include "dynamic_static/system/input-map.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+namespace dst {
+namespace sys {
+
+InputMap::Action InputMap::add_action()
+{
+    mActionStates.push_back(ActionState::None);
+    mCompiled = false;
+    return (Action)(mActionStates.size() - 1);
+}
+
+void InputMap::bind_action(Action action, dst::Span<const Keyboard::Key> keys, dst::Span<const Mouse::Button> buttons)
+{
+    assert(action < mActionStates.size());
+    assert(!keys.empty() || !buttons.empty());
+    ChordBinding chordBinding { };
+    chordBinding.action = action;
+    auto set_bit =
+        [&](size_t bit_i)
+        {
+            chordBinding.mask[bit_i / WordBitCount] |= (Word)1 << (bit_i % WordBitCount);
+        };
+    for (auto key : keys) {
+        set_bit(get_bit_index(key));
+    }
+    for (auto button : buttons) {
+        set_bit(get_bit_index(button));
+    }
+    mChordBindings.push_back(chordBinding);
+    mCompiled = false;
+}
+
+InputMap::Axis InputMap::add_axis()
+{
+    mAxisValues.push_back(0);
+    return (Axis)(mAxisValues.size() - 1);
+}
+
+void InputMap::bind_axis(Axis axis, Keyboard::Key key, float scale)
+{
+    assert(axis < mAxisValues.size());
+    mDigitalBits.push_back((uint32_t)get_bit_index(key));
+    mDigitalAxes.push_back(axis);
+    mDigitalScales.push_back(scale);
+}
+
+void InputMap::bind_axis(Axis axis, Mouse::Button button, float scale)
+{
+    assert(axis < mAxisValues.size());
+    mDigitalBits.push_back((uint32_t)get_bit_index(button));
+    mDigitalAxes.push_back(axis);
+    mDigitalScales.push_back(scale);
+}
+
+void InputMap::bind_axis(Axis axis, Analog analog, float scale)
+{
+    assert(axis < mAxisValues.size());
+    mAnalogs.push_back(analog);
+    mAnalogAxes.push_back(axis);
+    mAnalogScales.push_back(scale);
+}
+
+void InputMap::clear()
+{
+    *this = InputMap { };
+}
+
+void InputMap::compile()
+{
+    // NOTE : Chord masks are stored word major so that update() tests one word
+    //  of every chord at a time in a loop the compiler can vectorize.  Each
+    //  chord also records the chords that are strict supersets of it so that
+    //  a completed Ctrl+S suppresses S.
+    auto chordCount = mChordBindings.size();
+    mChordMasks.resize(WordCount * chordCount);
+    mChordActions.resize(chordCount);
+    for (size_t chord_i = 0; chord_i < chordCount; ++chord_i) {
+        const auto& chordBinding = mChordBindings[chord_i];
+        for (size_t word_i = 0; word_i < WordCount; ++word_i) {
+            mChordMasks[word_i * chordCount + chord_i] = chordBinding.mask[word_i];
+        }
+        mChordActions[chord_i] = chordBinding.action;
+    }
+    mSupersetOffsets.assign(1, 0);
+    mSupersets.clear();
+    for (size_t chord_i = 0; chord_i < chordCount; ++chord_i) {
+        const auto& mask = mChordBindings[chord_i].mask;
+        for (size_t superset_i = 0; superset_i < chordCount; ++superset_i) {
+            const auto& supersetMask = mChordBindings[superset_i].mask;
+            auto strictSuperset = mask != supersetMask;
+            for (size_t word_i = 0; strictSuperset && word_i < WordCount; ++word_i) {
+                strictSuperset = (supersetMask[word_i] & mask[word_i]) == mask[word_i];
+            }
+            if (strictSuperset) {
+                mSupersets.push_back((uint32_t)superset_i);
+            }
+        }
+        mSupersetOffsets.push_back((uint32_t)mSupersets.size());
+    }
+    mChordDown.resize(chordCount);
+    mChordCompleted.resize(chordCount);
+    mChordPressed.resize(chordCount);
+    mActionDown.resize(mActionStates.size());
+    mActionPressed.resize(mActionStates.size());
+    mCompiled = true;
+}
+
+void InputMap::update(const Input& input)
+{
+    if (!mCompiled) {
+        compile();
+    }
+    Words downWords { };
+    Words pressedWords { };
+    get_words(input.keyboard.down_keys(), input.mouse.down_buttons(), &downWords);
+    get_words(input.keyboard.pressed_keys(), input.mouse.pressed_buttons(), &pressedWords);
+
+    // NOTE : A chord is down when all of its inputs are down, it's pressed when
+    //  all of its inputs are down or were pressed this frame and at least one of
+    //  them was pressed this frame, this catches chords tapped within a frame.
+    auto chordCount = mChordActions.size();
+    std::fill(mChordDown.begin(), mChordDown.end(), (uint8_t)1);
+    std::fill(mChordCompleted.begin(), mChordCompleted.end(), (uint8_t)1);
+    std::fill(mChordPressed.begin(), mChordPressed.end(), (uint8_t)0);
+    for (size_t word_i = 0; word_i < WordCount; ++word_i) {
+        auto downWord = downWords[word_i];
+        auto pressedWord = pressedWords[word_i];
+        auto touchedWord = downWord | pressedWord;
+        const auto* pMasks = mChordMasks.data() + word_i * chordCount;
+        for (size_t chord_i = 0; chord_i < chordCount; ++chord_i) {
+            auto mask = pMasks[chord_i];
+            mChordDown[chord_i] &= (uint8_t)((downWord & mask) == mask);
+            mChordCompleted[chord_i] &= (uint8_t)((touchedWord & mask) == mask);
+            mChordPressed[chord_i] |= (uint8_t)((pressedWord & mask) != 0);
+        }
+    }
+    for (size_t chord_i = 0; chord_i < chordCount; ++chord_i) {
+        mChordPressed[chord_i] &= mChordCompleted[chord_i];
+    }
+
+    std::fill(mActionDown.begin(), mActionDown.end(), (uint8_t)0);
+    std::fill(mActionPressed.begin(), mActionPressed.end(), (uint8_t)0);
+    for (size_t chord_i = 0; chord_i < chordCount; ++chord_i) {
+        auto down = mChordDown[chord_i];
+        auto pressed = mChordPressed[chord_i];
+        for (auto superset_i = mSupersetOffsets[chord_i]; superset_i < mSupersetOffsets[chord_i + 1] && (down || pressed); ++superset_i) {
+            down &= !mChordDown[mSupersets[superset_i]];
+            pressed &= !mChordPressed[mSupersets[superset_i]];
+        }
+        mActionDown[mChordActions[chord_i]] |= down;
+        mActionPressed[mChordActions[chord_i]] |= pressed;
+    }
+    for (size_t action_i = 0; action_i < mActionStates.size(); ++action_i) {
+        auto& actionState = mActionStates[action_i];
+        auto previousDown = (int)(actionState & ActionState::Down);
+        auto down = mActionDown[action_i];
+        auto pressed = mActionPressed[action_i];
+        actionState = ActionState::None;
+        actionState |= down ? ActionState::Down : ActionState::None;
+        actionState |= pressed ? ActionState::Pressed : ActionState::None;
+        actionState |= (previousDown || pressed) && !down ? ActionState::Released : ActionState::None;
+    }
+
+    std::fill(mAxisValues.begin(), mAxisValues.end(), 0.0f);
+    for (size_t digital_i = 0; digital_i < mDigitalBits.size(); ++digital_i) {
+        auto bit_i = mDigitalBits[digital_i];
+        auto down = (downWords[bit_i / WordBitCount] >> (bit_i % WordBitCount)) & 1;
+        mAxisValues[mDigitalAxes[digital_i]] += down ? mDigitalScales[digital_i] : 0.0f;
+    }
+    if (!mAnalogs.empty()) {
+        auto motion = input.mouse.motion_delta();
+        std::array<float, 3> analogValues { };
+        analogValues[(size_t)Analog::MouseScroll] = input.mouse.scroll_delta();
+        analogValues[(size_t)Analog::MouseMotionX] = (float)motion.x;
+        analogValues[(size_t)Analog::MouseMotionY] = (float)motion.y;
+        for (size_t analog_i = 0; analog_i < mAnalogs.size(); ++analog_i) {
+            mAxisValues[mAnalogAxes[analog_i]] += analogValues[(size_t)mAnalogs[analog_i]] * mAnalogScales[analog_i];
+        }
+    }
+}
+
+bool InputMap::down(Action action) const
+{
+    assert(action < mActionStates.size());
+    return (int)(mActionStates[action] & ActionState::Down);
+}
+
+bool InputMap::pressed(Action action) const
+{
+    assert(action < mActionStates.size());
+    return (int)(mActionStates[action] & ActionState::Pressed);
+}
+
+bool InputMap::released(Action action) const
+{
+    assert(action < mActionStates.size());
+    return (int)(mActionStates[action] & ActionState::Released);
+}
+
+float InputMap::value(Axis axis) const
+{
+    assert(axis < mAxisValues.size());
+    return mAxisValues[axis];
+}
+
+dst::Span<const InputMap::ActionState> InputMap::get_action_states() const
+{
+    return mActionStates;
+}
+
+dst::Span<const float> InputMap::get_axis_values() const
+{
+    return mAxisValues;
+}
+
+size_t InputMap::get_bit_index(Keyboard::Key key)
+{
+    assert((int)key < (int)Keyboard::Key::Count);
+    return (size_t)key;
+}
+
+size_t InputMap::get_bit_index(Mouse::Button button)
+{
+    assert((int)button < (int)Mouse::Button::Count);
+    return KeyboardWordCount * WordBitCount + (size_t)button;
+}
+
+void InputMap::get_words(const Keyboard::State& keys, const BitSet<(int)Mouse::Button::Count>& buttons, Words* pWords)
+{
+    assert(pWords);
+    std::copy(keys.get_words().begin(), keys.get_words().end(), pWords->begin());
+    std::copy(buttons.get_words().begin(), buttons.get_words().end(), pWords->begin() + KeyboardWordCount);
+}
+
+} // namespace sys
+} // namespace dst
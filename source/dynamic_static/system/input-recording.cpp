@@ -0,0 +1,171 @@
+
+/*
+==========================================
+  Copyright (c) 2020 Dynamic_Static
+    Patrick Purcell
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#include "dynamic_static/system/input-recording.hpp"
+
+#include <cassert>
+#include <stdexcept>
+#include <type_traits>
+
+namespace dst {
+namespace sys {
+namespace {
+
+static constexpr uint8_t FrameEndTag { 0 };
+
+template <typename T>
+inline void write_value(std::ofstream& file, const T& value)
+{
+    static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable values can be written");
+    file.write((const char*)&value, sizeof(T));
+}
+
+template <typename T>
+inline bool read_value(std::ifstream& file, T* pValue)
+{
+    static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable values can be read");
+    assert(pValue);
+    return (bool)file.read((char*)pValue, sizeof(T));
+}
+
+inline bool has_action(Input::Event::Type type)
+{
+    return type == Input::Event::Type::Key || type == Input::Event::Type::MouseButton || type == Input::Event::Type::GamepadConnection || type == Input::Event::Type::GamepadButton;
+}
+
+inline bool has_code(Input::Event::Type type)
+{
+    return has_action(type) || type == Input::Event::Type::Text || type == Input::Event::Type::GamepadAxis;
+}
+
+inline bool has_value(Input::Event::Type type)
+{
+    return !has_code(type) || type == Input::Event::Type::GamepadAxis;
+}
+
+} // namespace
+
+InputRecorder::InputRecorder(const std::filesystem::path& filePath)
+    : mFile { filePath, std::ios::binary | std::ios::trunc }
+    , mBegin { dst::HighResolutionClock::now() }
+{
+    if (!mFile) {
+        throw std::runtime_error("Failed to open Input recording file : " + filePath.string());
+    }
+    write_value(mFile, InputRecording::FileMagic);
+    write_value(mFile, InputRecording::FileVersion);
+}
+
+bool InputRecorder::is_open() const
+{
+    return mFile.is_open();
+}
+
+void InputRecorder::write(const Input::Event& event)
+{
+    if (is_open()) {
+        write_value(mFile, (uint8_t)((uint8_t)event.type + 1));
+        if (has_action(event.type)) {
+            write_value(mFile, (uint8_t)event.action);
+        }
+        if (has_code(event.type)) {
+            write_value(mFile, event.code);
+        }
+        if (has_value(event.type)) {
+            write_value(mFile, event.value.x);
+            write_value(mFile, event.value.y);
+        }
+        write_value(mFile, (int64_t)dst::duration_cast<dst::Nanoseconds<int64_t>>(event.timestamp - mBegin).count());
+    }
+}
+
+void InputRecorder::end_frame()
+{
+    if (is_open()) {
+        write_value(mFile, FrameEndTag);
+    }
+}
+
+void InputRecorder::close()
+{
+    if (is_open()) {
+        mFile.close();
+    }
+}
+
+InputReplayer::InputReplayer(const std::filesystem::path& filePath)
+    : mFile { filePath, std::ios::binary }
+    , mBegin { dst::HighResolutionClock::now() }
+{
+    if (!mFile) {
+        throw std::runtime_error("Failed to open Input recording file : " + filePath.string());
+    }
+    uint32_t magic = 0;
+    uint32_t version = 0;
+    if (!read_value(mFile, &magic) || magic != InputRecording::FileMagic) {
+        throw std::runtime_error("Failed to read Input recording file : " + filePath.string() + " isn't an Input recording");
+    }
+    if (!read_value(mFile, &version) || version < InputRecording::MinFileVersion || InputRecording::FileVersion < version) {
+        throw std::runtime_error("Failed to read Input recording file : " + filePath.string() + " has unsupported version " + std::to_string(version));
+    }
+}
+
+bool InputReplayer::is_open() const
+{
+    return mFile.is_open();
+}
+
+bool InputReplayer::read_frame(std::vector<Input::Event>* pEvents)
+{
+    assert(pEvents);
+    pEvents->clear();
+    uint8_t tag = FrameEndTag;
+    while (is_open() && read_value(mFile, &tag)) {
+        if (tag == FrameEndTag) {
+            return true;
+        }
+        Input::Event event { };
+        event.type = (Input::Event::Type)(tag - 1);
+        if (Input::Event::Type::GamepadAxis < event.type) {
+            break;
+        }
+        bool valid = true;
+        if (has_action(event.type)) {
+            valid &= read_value(mFile, &event.action);
+        }
+        if (has_code(event.type)) {
+            valid &= read_value(mFile, &event.code);
+        }
+        if (has_value(event.type)) {
+            valid &= read_value(mFile, &event.value.x);
+            valid &= read_value(mFile, &event.value.y);
+        }
+        int64_t timestamp = 0;
+        valid &= read_value(mFile, &timestamp);
+        if (!valid || Input::Event::Action::Repeat < event.action) {
+            break;
+        }
+        event.timestamp = mBegin + dst::duration_cast<dst::HighResolutionClock::duration>(dst::Nanoseconds<int64_t>(timestamp));
+        pEvents->push_back(event);
+    }
+    pEvents->clear();
+    close();
+    return false;
+}
+
+void InputReplayer::close()
+{
+    if (is_open()) {
+        mFile.close();
+    }
+}
+
+} // namespace sys
+} // namespace dst
@@ -10,31 +10,165 @@
 
 #include "dynamic_static/system/input.hpp"
 
-#include <utility>
+#include <algorithm>
+#include <cassert>
+#include <limits>
 
 namespace dst {
 namespace sys {
+namespace {
+
+template <typename CountsType, typename MaskType>
+void accumulate_counts(const CountsType& counts, const MaskType& mask, CountsType* pCounts, MaskType* pMask)
+{
+    assert(pCounts);
+    assert(pMask);
+    for (auto i : mask) {
+        auto count = (uint32_t)(*pCounts)[i] + counts[i];
+        (*pCounts)[i] = (uint8_t)std::min(count, (uint32_t)std::numeric_limits<uint8_t>::max());
+    }
+    *pMask |= mask;
+}
+
+} // namespace
+
+void Input::stage(const Event& event)
+{
+    if (mStagedEventCount == mStagedEvents.size()) {
+        apply(mStagedEvents[mStagedEventBegin]);
+        mStagedEventBegin = (mStagedEventBegin + 1) % mStagedEvents.size();
+        --mStagedEventCount;
+    }
+    mStagedEvents[(mStagedEventBegin + mStagedEventCount) % mStagedEvents.size()] = event;
+    ++mStagedEventCount;
+}
+
+dst::Span<const Input::Event> Input::get_events() const
+{
+    return { mEvents.data(), mEventCount };
+}
 
 void Input::update()
 {
-    mPreviousKeyboard = keyboard;
+    for (size_t i = 0; i < mStagedEventCount; ++i) {
+        const auto& event = mStagedEvents[(mStagedEventBegin + i) % mStagedEvents.size()];
+        apply(event);
+        mEvents[i] = event;
+    }
+    mEventCount = mStagedEventCount;
+    mStagedEventBegin = 0;
+    mStagedEventCount = 0;
     keyboard.update();
-    mPreviousMouse = mouse;
     mouse.update();
+    gamepad.update();
+    history.advance(keyboard, mouse, gamepad, dst::HighResolutionClock::now());
 }
 
 void Input::reset()
 {
-    mPreviousKeyboard.reset();
     keyboard.reset();
-    mPreviousMouse.reset();
     mouse.reset();
+    gamepad.reset();
+    history.reset();
+    mStagedEventBegin = 0;
+    mStagedEventCount = 0;
+    mEventCount = 0;
+}
+
+void Input::revert(size_t frameCount)
+{
+    // NOTE : The reverted state is restored from the InputHistory into the
+    //  previous, current, and staged Keyboard and Mouse state so that nothing
+    //  appears to have changed, then recorded in place of the reverted frames.
+    //  Gamepad state is polled rather than event driven so it isn't reverted,
+    //  its staged state is left alone and only its transitions are cleared.
+    assert(frameCount);
+    auto timestamp = history.size() ? history.get_frame(0).timestamp : dst::HighResolutionClock::now();
+    auto frame = frameCount < history.size() ? history.get_frame(frameCount) : InputHistory::Frame { };
+    keyboard.reset();
+    keyboard.previous = frame.keys;
+    keyboard.current = frame.keys;
+    keyboard.staged = frame.keys;
+    mouse.reset();
+    mouse.current.scroll = frame.scroll;
+    mouse.current.position = frame.position;
+    mouse.current.buttons = frame.buttons;
+    mouse.previous = mouse.current;
+    mouse.staged = mouse.current;
+    gamepad.previous = gamepad.current;
+    history.rewind(frameCount);
+    history.advance(keyboard, mouse, gamepad, timestamp);
+}
+
+void Input::snapshot(const Input& input)
+{
+    assert(this != &input);
+    keyboard = input.keyboard;
+    mouse = input.mouse;
+    gamepad = input.gamepad;
+    history.reset();
+    mStagedEventBegin = 0;
+    mStagedEventCount = 0;
+    mEventCount = input.mEventCount;
+    std::copy_n(input.mEvents.begin(), mEventCount, mEvents.begin());
+}
+
+void Input::accumulate(const Input& input)
+{
+    // NOTE : previous is kept from the first folded frame so that the transitions
+    //  and deltas derived from previous and current span every folded frame,
+    //  Counts and masks catch presses and releases that cancelled out.
+    assert(this != &input);
+    keyboard.current = input.keyboard.current;
+    keyboard.staged = input.keyboard.staged;
+    accumulate_counts(input.keyboard.pressCounts, input.keyboard.pressMask, &keyboard.pressCounts, &keyboard.pressMask);
+    accumulate_counts(input.keyboard.releaseCounts, input.keyboard.releaseMask, &keyboard.releaseCounts, &keyboard.releaseMask);
+    auto motion = mouse.current.motion + input.mouse.current.motion;
+    mouse.current = input.mouse.current;
+    mouse.current.motion = motion;
+    mouse.staged = input.mouse.staged;
+    accumulate_counts(input.mouse.pressCounts, input.mouse.pressMask, &mouse.pressCounts, &mouse.pressMask);
+    accumulate_counts(input.mouse.releaseCounts, input.mouse.releaseMask, &mouse.releaseCounts, &mouse.releaseMask);
+    gamepad.current = input.gamepad.current;
+    gamepad.staged = input.gamepad.staged;
+    auto eventCount = std::min(input.mEventCount, EventCapacity - mEventCount);
+    std::copy_n(input.mEvents.begin(), eventCount, mEvents.begin() + mEventCount);
+    mEventCount += eventCount;
 }
 
-void Input::revert()
+void Input::apply(const Event& event)
 {
-    std::swap(keyboard, mPreviousKeyboard);
-    std::swap(mouse, mPreviousMouse);
+    switch (event.type) {
+    case Event::Type::Key: {
+        keyboard.stage((Keyboard::Key)event.code, event.action != Event::Action::Release);
+    } break;
+    case Event::Type::MouseButton: {
+        mouse.stage((Mouse::Button)event.code, event.action != Event::Action::Release);
+    } break;
+    case Event::Type::MousePosition: {
+        mouse.stage(event.value);
+    } break;
+    case Event::Type::MouseScroll: {
+        mouse.staged.scroll += (float)event.value.y;
+    } break;
+    case Event::Type::GamepadConnection: {
+        gamepad.stage_connection(event.code, event.action != Event::Action::Release);
+    } break;
+    case Event::Type::GamepadButton: {
+        gamepad.stage(event.get_gamepad_index(), (Gamepad::Button)event.get_gamepad_element(), event.action != Event::Action::Release);
+    } break;
+    case Event::Type::GamepadAxis: {
+        gamepad.stage(event.get_gamepad_index(), (Gamepad::Axis)event.get_gamepad_element(), (float)event.value.x);
+    } break;
+    case Event::Type::Text:
+    case Event::Type::Resize: {
+        // NOTE : Text and Resize Input::Events are staged so that they're
+        //  reported by get_events(), they don't affect Keyboard or Mouse state.
+    } break;
+    default: {
+        assert(false);
+    } break;
+    }
 }
 
 } // namespace sys
@@ -10,6 +10,8 @@
 
 #include "dynamic_static/system/keyboard.hpp"
 
+#include <limits>
+
 namespace dst {
 namespace sys {
 
@@ -30,18 +32,68 @@ bool Keyboard::held(Keyboard::Key key) const
 
 bool Keyboard::pressed(Keyboard::Key key) const
 {
-    return previous[(int)key] == KeyUp && current[(int)key] == KeyDown;
+    return pressCounts[(int)key] || (previous[(int)key] == KeyUp && current[(int)key] == KeyDown);
 }
 
 bool Keyboard::released(Keyboard::Key key) const
 {
-    return previous[(int)key] == KeyDown && current [(int)key] == KeyUp;
+    return releaseCounts[(int)key] || (previous[(int)key] == KeyDown && current [(int)key] == KeyUp);
+}
+
+uint32_t Keyboard::press_count(Keyboard::Key key) const
+{
+    return pressCounts[(int)key];
+}
+
+uint32_t Keyboard::release_count(Keyboard::Key key) const
+{
+    return releaseCounts[(int)key];
+}
+
+const Keyboard::State& Keyboard::down_keys() const
+{
+    return current;
+}
+
+Keyboard::State Keyboard::held_keys() const
+{
+    return previous & current;
+}
+
+Keyboard::State Keyboard::pressed_keys() const
+{
+    return pressMask | (~previous & current);
+}
+
+Keyboard::State Keyboard::released_keys() const
+{
+    return releaseMask | (previous & ~current);
+}
+
+void Keyboard::stage(Keyboard::Key key, bool down)
+{
+    if (staged[(int)key] != down) {
+        staged.set((int)key, down);
+        auto& count = down ? stagedPressCounts[(int)key] : stagedReleaseCounts[(int)key];
+        if (count < std::numeric_limits<uint8_t>::max()) {
+            ++count;
+        }
+        (down ? stagedPressMask : stagedReleaseMask).set((int)key);
+    }
 }
 
 void Keyboard::update()
 {
     previous = current;
     current = staged;
+    pressCounts = stagedPressCounts;
+    releaseCounts = stagedReleaseCounts;
+    stagedPressCounts.fill(0);
+    stagedReleaseCounts.fill(0);
+    pressMask = stagedPressMask;
+    releaseMask = stagedReleaseMask;
+    stagedPressMask.reset();
+    stagedReleaseMask.reset();
 }
 
 void Keyboard::reset()
@@ -49,6 +101,14 @@ void Keyboard::reset()
     previous.reset();
     current.reset();
     staged.reset();
+    pressCounts.fill(0);
+    releaseCounts.fill(0);
+    stagedPressCounts.fill(0);
+    stagedReleaseCounts.fill(0);
+    pressMask.reset();
+    releaseMask.reset();
+    stagedPressMask.reset();
+    stagedReleaseMask.reset();
 }
 
 } // namespace sys
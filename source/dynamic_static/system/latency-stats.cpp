@@ -0,0 +1,67 @@
+
+/*
+==========================================
+  Copyright (c) 2020 Dynamic_Static
+    Patrick Purcell
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#include "dynamic_static/system/latency-stats.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace dst {
+namespace sys {
+
+double LatencyStats::Histogram::get_percentile(double percentile) const
+{
+    if (sampleCount) {
+        auto rank = (uint64_t)std::ceil(std::clamp(percentile, 0.0, 1.0) * sampleCount);
+        rank = std::max(rank, (uint64_t)1);
+        uint64_t count = 0;
+        for (size_t bucket_i = 0; bucket_i < buckets.size(); ++bucket_i) {
+            count += buckets[bucket_i];
+            if (rank <= count) {
+                return std::min((bucket_i + 1) * BucketWidth, max);
+            }
+        }
+        return max;
+    }
+    return 0;
+}
+
+double LatencyStats::Histogram::get_mean() const
+{
+    return sampleCount ? sum / sampleCount : 0;
+}
+
+void LatencyStats::record(const Input::Event& event, dst::TimePoint<> presentTimePoint)
+{
+    assert((size_t)event.type < EventTypeCount);
+    auto& histogram = mHistograms[(size_t)event.type];
+    auto latency = std::max(0.0, dst::duration_cast<dst::Seconds<double>>(presentTimePoint - event.timestamp).count());
+    auto bucket_i = std::min((size_t)(latency / BucketWidth), BucketCount - 1);
+    ++histogram.buckets[bucket_i];
+    histogram.min = histogram.sampleCount ? std::min(histogram.min, latency) : latency;
+    histogram.max = std::max(histogram.max, latency);
+    histogram.sum += latency;
+    ++histogram.sampleCount;
+}
+
+const LatencyStats::Histogram& LatencyStats::get_histogram(Input::Event::Type type) const
+{
+    assert((size_t)type < EventTypeCount);
+    return mHistograms[(size_t)type];
+}
+
+void LatencyStats::reset()
+{
+    mHistograms = { };
+}
+
+} // namespace sys
+} // namespace dst
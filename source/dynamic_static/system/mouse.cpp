@@ -10,6 +10,8 @@
 
 #include "dynamic_static/system/mouse.hpp"
 
+#include <limits>
+
 namespace dst {
 namespace sys {
 
@@ -23,6 +25,11 @@ glm::vec2 Mouse::position_delta() const
     return current.position - previous.position;
 }
 
+glm::dvec2 Mouse::motion_delta() const
+{
+    return current.motion;
+}
+
 bool Mouse::up(Mouse::Button button) const
 {
     return current.buttons[(int)button] == ButtonUp;
@@ -40,18 +47,79 @@ bool Mouse::held(Mouse::Button button) const
 
 bool Mouse::pressed(Mouse::Button button) const
 {
-    return previous.buttons[(int)button] == ButtonUp && current.buttons[(int)button] == ButtonDown;
+    return pressCounts[(int)button] || (previous.buttons[(int)button] == ButtonUp && current.buttons[(int)button] == ButtonDown);
 }
 
 bool Mouse::released(Mouse::Button button) const
 {
-    return previous.buttons[(int)button] == ButtonDown && current.buttons[(int)button] == ButtonUp;
+    return releaseCounts[(int)button] || (previous.buttons[(int)button] == ButtonDown && current.buttons[(int)button] == ButtonUp);
+}
+
+uint32_t Mouse::press_count(Mouse::Button button) const
+{
+    return pressCounts[(int)button];
+}
+
+uint32_t Mouse::release_count(Mouse::Button button) const
+{
+    return releaseCounts[(int)button];
+}
+
+const BitSet<(int)Mouse::Button::Count>& Mouse::down_buttons() const
+{
+    return current.buttons;
+}
+
+BitSet<(int)Mouse::Button::Count> Mouse::held_buttons() const
+{
+    return previous.buttons & current.buttons;
+}
+
+BitSet<(int)Mouse::Button::Count> Mouse::pressed_buttons() const
+{
+    return pressMask | (~previous.buttons & current.buttons);
+}
+
+BitSet<(int)Mouse::Button::Count> Mouse::released_buttons() const
+{
+    return releaseMask | (previous.buttons & ~current.buttons);
+}
+
+void Mouse::stage(Mouse::Button button, bool down)
+{
+    if (staged.buttons[(int)button] != down) {
+        staged.buttons.set((int)button, down);
+        auto& count = down ? stagedPressCounts[(int)button] : stagedReleaseCounts[(int)button];
+        if (count < std::numeric_limits<uint8_t>::max()) {
+            ++count;
+        }
+        (down ? stagedPressMask : stagedReleaseMask).set((int)button);
+    }
+}
+
+void Mouse::stage(const glm::dvec2& position)
+{
+    if (mStagedPositionValid) {
+        staged.motion += position - mStagedPosition;
+    }
+    mStagedPosition = position;
+    mStagedPositionValid = true;
+    staged.position = { (float)position.x, (float)position.y };
 }
 
 void Mouse::update()
 {
     previous = current;
     current = staged;
+    staged.motion = { };
+    pressCounts = stagedPressCounts;
+    releaseCounts = stagedReleaseCounts;
+    stagedPressCounts.fill(0);
+    stagedReleaseCounts.fill(0);
+    pressMask = stagedPressMask;
+    releaseMask = stagedReleaseMask;
+    stagedPressMask.reset();
+    stagedReleaseMask.reset();
 }
 
 void Mouse::reset()
@@ -59,12 +127,23 @@ void Mouse::reset()
     previous.reset();
     current.reset();
     staged.reset();
+    pressCounts.fill(0);
+    releaseCounts.fill(0);
+    stagedPressCounts.fill(0);
+    stagedReleaseCounts.fill(0);
+    pressMask.reset();
+    releaseMask.reset();
+    stagedPressMask.reset();
+    stagedReleaseMask.reset();
+    mStagedPosition = { };
+    mStagedPositionValid = false;
 }
 
 void Mouse::State::reset()
 {
     scroll = { };
     position = { };
+    motion = { };
     buttons.reset();
 }
 
@@ -0,0 +1,197 @@
+
+/*
+==========================================
+  Copyright (c) 2020 Dynamic_Static
+    Patrick Purcell
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#include "dynamic_static/system/opengl/dynamic-resolution.hpp"
+
+#ifdef DYNAMIC_STATIC_SYSTEM_OPENGL_ENABLED
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+namespace dst {
+namespace sys {
+namespace gl {
+
+DynamicResolution::DynamicResolution()
+    : DynamicResolution(Info { })
+{
+}
+
+DynamicResolution::DynamicResolution(const Info& info)
+    : mInfo { info }
+{
+    assert(0 < mInfo.minScale && mInfo.minScale <= mInfo.maxScale);
+    mScale = std::clamp(1.0f, mInfo.minScale, mInfo.maxScale);
+    dst_gl(glGenQueries((GLsizei)mQueries.size(), mQueries.data()));
+    GLint timerBits = 0;
+    dst_gl(glGetQueryiv(GL_TIME_ELAPSED, GL_QUERY_COUNTER_BITS, &timerBits));
+    mTimerQueriesSupported = 0 < timerBits;
+}
+
+DynamicResolution::~DynamicResolution()
+{
+    destroy_render_targets();
+    dst_gl(glDeleteQueries((GLsizei)mQueries.size(), mQueries.data()));
+}
+
+const DynamicResolution::Info& DynamicResolution::get_info() const
+{
+    return mInfo;
+}
+
+float DynamicResolution::get_scale() const
+{
+    return mScale;
+}
+
+void DynamicResolution::set_scale(float scale)
+{
+    mScale = std::clamp(scale, mInfo.minScale, mInfo.maxScale);
+}
+
+glm::ivec2 DynamicResolution::get_render_extent() const
+{
+    return mRenderExtent;
+}
+
+double DynamicResolution::get_gpu_time() const
+{
+    return mGpuTime;
+}
+
+void DynamicResolution::update(const FrameStats& frameStats)
+{
+    // NOTE : Queries are checked oldest first, mQueryIndex is the next query to
+    //  be issued so it's also the oldest.
+    for (size_t i = 0; i < mQueries.size(); ++i) {
+        auto query_i = (mQueryIndex + i) % mQueries.size();
+        if (mQueriesPending[query_i]) {
+            GLint available = GL_FALSE;
+            dst_gl(glGetQueryObjectiv(mQueries[query_i], GL_QUERY_RESULT_AVAILABLE, &available));
+            if (!available) {
+                break;
+            }
+            GLuint64 nanoseconds = 0;
+            dst_gl(glGetQueryObjectui64v(mQueries[query_i], GL_QUERY_RESULT, &nanoseconds));
+            mQueriesPending[query_i] = false;
+            mGpuTime = (double)nanoseconds * 1e-9;
+        }
+    }
+    // NOTE : While the GPU is behind no new results arrive, the last GPU time is
+    //  reused rather than falling back to CPU time so the two aren't mixed.  CPU
+    //  time is only used when timer queries aren't supported.
+    auto frameTime = mTimerQueriesSupported ? mGpuTime : frameStats.get_last(FrameStats::Phase::Draw);
+    if (0 < frameTime && 0 < mInfo.targetFrameTime) {
+        // NOTE : Cost is roughly proportional to pixel count, so the scale applied
+        //  to each axis is proportional to the square root of the time ratio.
+        auto desiredScale = mScale * (float)std::sqrt(mInfo.targetFrameTime / frameTime);
+        desiredScale = std::clamp(desiredScale, mInfo.minScale, mInfo.maxScale);
+        set_scale(mScale + (desiredScale - mScale) * std::clamp(mInfo.adjustmentRate, 0.0f, 1.0f));
+    }
+}
+
+void DynamicResolution::begin(const glm::ivec2& extent)
+{
+    GLint targetFramebuffer = 0;
+    dst_gl(glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &targetFramebuffer));
+    mTargetFramebuffer = (GLuint)targetFramebuffer;
+    if (mExtent != extent) {
+        create_render_targets(extent);
+    }
+    mRenderExtent = {
+        std::max(1, (int)std::lround(extent.x * mScale)),
+        std::max(1, (int)std::lround(extent.y * mScale)),
+    };
+    dst_gl(glBindFramebuffer(GL_FRAMEBUFFER, mFramebuffer));
+    dst_gl(glViewport(0, 0, mRenderExtent.x, mRenderExtent.y));
+    mQueryActive = mTimerQueriesSupported && !mQueriesPending[mQueryIndex];
+    if (mQueryActive) {
+        dst_gl(glBeginQuery(GL_TIME_ELAPSED, mQueries[mQueryIndex]));
+    }
+}
+
+void DynamicResolution::end()
+{
+    end(mTargetFramebuffer);
+}
+
+void DynamicResolution::end(GLuint framebuffer)
+{
+    if (mQueryActive) {
+        dst_gl(glEndQuery(GL_TIME_ELAPSED));
+        mQueriesPending[mQueryIndex] = true;
+        mQueryIndex = (mQueryIndex + 1) % mQueries.size();
+        mQueryActive = false;
+    }
+    dst_gl(glDisable(GL_SCISSOR_TEST));
+    dst_gl(glBindFramebuffer(GL_READ_FRAMEBUFFER, mFramebuffer));
+    dst_gl(glBindFramebuffer(GL_DRAW_FRAMEBUFFER, framebuffer));
+    dst_gl(glBlitFramebuffer(
+        0, 0, mRenderExtent.x, mRenderExtent.y,
+        0, 0, mExtent.x, mExtent.y,
+        GL_COLOR_BUFFER_BIT,
+        mRenderExtent == mExtent ? GL_NEAREST : GL_LINEAR
+    ));
+    dst_gl(glBindFramebuffer(GL_FRAMEBUFFER, framebuffer));
+    dst_gl(glViewport(0, 0, mExtent.x, mExtent.y));
+}
+
+void DynamicResolution::create_render_targets(const glm::ivec2& extent)
+{
+    destroy_render_targets();
+    mExtent = extent;
+    glm::ivec2 allocationExtent {
+        std::max(1, (int)std::ceil(extent.x * mInfo.maxScale)),
+        std::max(1, (int)std::ceil(extent.y * mInfo.maxScale)),
+    };
+    dst_gl(glGenRenderbuffers(1, &mColorRenderbuffer));
+    dst_gl(glBindRenderbuffer(GL_RENDERBUFFER, mColorRenderbuffer));
+    dst_gl(glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, allocationExtent.x, allocationExtent.y));
+    dst_gl(glGenRenderbuffers(1, &mDepthStencilRenderbuffer));
+    dst_gl(glBindRenderbuffer(GL_RENDERBUFFER, mDepthStencilRenderbuffer));
+    dst_gl(glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, allocationExtent.x, allocationExtent.y));
+    dst_gl(glBindRenderbuffer(GL_RENDERBUFFER, 0));
+    dst_gl(glGenFramebuffers(1, &mFramebuffer));
+    dst_gl(glBindFramebuffer(GL_FRAMEBUFFER, mFramebuffer));
+    dst_gl(glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, mColorRenderbuffer));
+    dst_gl(glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, mDepthStencilRenderbuffer));
+    GLenum framebufferStatus = GL_FRAMEBUFFER_COMPLETE;
+    dst_gl(framebufferStatus = glCheckFramebufferStatus(GL_FRAMEBUFFER));
+    if (framebufferStatus != GL_FRAMEBUFFER_COMPLETE) {
+        destroy_render_targets();
+        throw std::runtime_error("Failed to create dynamic resolution framebuffer : " + std::to_string(framebufferStatus));
+    }
+}
+
+void DynamicResolution::destroy_render_targets()
+{
+    if (mFramebuffer) {
+        dst_gl(glDeleteFramebuffers(1, &mFramebuffer));
+    }
+    if (mColorRenderbuffer) {
+        dst_gl(glDeleteRenderbuffers(1, &mColorRenderbuffer));
+    }
+    if (mDepthStencilRenderbuffer) {
+        dst_gl(glDeleteRenderbuffers(1, &mDepthStencilRenderbuffer));
+    }
+    mFramebuffer = 0;
+    mColorRenderbuffer = 0;
+    mDepthStencilRenderbuffer = 0;
+    mExtent = { };
+}
+
+} // namespace gl
+} // namespace sys
+} // namespace dst
+
+#endif // DYNAMIC_STATIC_SYSTEM_OPENGL_ENABLED
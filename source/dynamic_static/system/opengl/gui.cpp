@@ -9,6 +9,7 @@
 */
 
 #include "dynamic_static/system/opengl/gui.hpp"
+#include "dynamic_static/system/allocation-tracker.hpp"
 
 #ifdef DYNAMIC_STATIC_SYSTEM_OPENGL_ENABLED
 
@@ -28,7 +29,8 @@ inline void enable_vertex_attributes<ImDrawVert>()
     }});
 }
 
-Gui::Gui()
+Gui::Gui(ImFontAtlas* pFontAtlas)
+    : sys::Gui(pFontAtlas)
 {
     int fontWidth = 0;
     int fontHeight = 0;
@@ -87,6 +89,7 @@ Gui::~Gui()
 
 void Gui::draw()
 {
+    dst_allocation_scope("gl::Gui::draw");
     ImGui::Render();
     const auto& io = ImGui::GetIO();
     auto drawData = ImGui::GetDrawData();
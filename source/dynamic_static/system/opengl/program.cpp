@@ -71,8 +71,14 @@ std::string Program::info_log() const
 
 GLint Program::uniform_location(const std::string& uniformName) const
 {
+    return uniform_location(uniformName.c_str());
+}
+
+GLint Program::uniform_location(const char* pUniformName) const
+{
+    assert(pUniformName);
     GLint uniformLocation = 0;
-    dst_gl(uniformLocation = glGetUniformLocation(mHandle, uniformName.c_str()));
+    dst_gl(uniformLocation = glGetUniformLocation(mHandle, pUniformName));
     return uniformLocation;
 }
 
@@ -0,0 +1,181 @@
+
+/*
+==========================================
+  Copyright (c) 2020 Dynamic_Static
+    Patrick Purcell
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#include "dynamic_static/system/system.hpp"
+
+#include "GLFW/glfw3.h"
+
+#include <cassert>
+#include <utility>
+
+namespace dst {
+namespace sys {
+
+System::System()
+    : System(Info { })
+{
+}
+
+System::System(const Info& info)
+    : mInfo { info }
+{
+    auto begin = dst::HighResolutionClock::now();
+    auto end_phase =
+        [&](Phase phase)
+        {
+            auto now = dst::HighResolutionClock::now();
+            mPhaseTimes[(size_t)phase] = dst::duration_cast<dst::Seconds<double>>(now - begin).count();
+            begin = now;
+        };
+    Window::access_registry(
+        [](Window::Registry&)
+        {
+            Window::acquire_glfw();
+        }
+    );
+    end_phase(Phase::Initialization);
+
+    // NOTE : GLFW monitor queries are restricted to the main thread so Monitors
+    //  are enumerated here rather than during prewarm.
+    int monitorCount = 0;
+    auto ppGlfwMonitors = glfwGetMonitors(&monitorCount);
+    auto pPrimaryGlfwMonitor = glfwGetPrimaryMonitor();
+    mMonitors.reserve(monitorCount);
+    for (int i = 0; i < monitorCount; ++i) {
+        Monitor monitor { };
+        auto pName = glfwGetMonitorName(ppGlfwMonitors[i]);
+        monitor.name = pName ? pName : std::string();
+        glfwGetMonitorPos(ppGlfwMonitors[i], &monitor.position.x, &monitor.position.y);
+        if (auto pVideoMode = glfwGetVideoMode(ppGlfwMonitors[i])) {
+            monitor.extent = { pVideoMode->width, pVideoMode->height };
+            monitor.refreshRate = pVideoMode->refreshRate;
+        }
+        monitor.primary = ppGlfwMonitors[i] == pPrimaryGlfwMonitor;
+        mMonitors.push_back(std::move(monitor));
+    }
+    end_phase(Phase::MonitorEnumeration);
+
+    #ifdef DYNAMIC_STATIC_SYSTEM_OPENGL_ENABLED
+    if (mInfo.pGlInfo) {
+        Window::Info windowInfo { };
+        windowInfo.flags = Window::Info::Flags::ThrottleBackground;
+        windowInfo.pName = "Dynamic_Static System";
+        windowInfo.extent = { 1, 1 };
+        windowInfo.pGlInfo = mInfo.pGlInfo;
+        mShareWindow = std::make_unique<Window>(windowInfo);
+        glfwMakeContextCurrent(nullptr);
+    }
+    end_phase(Phase::ContextCreation);
+    #endif // DYNAMIC_STATIC_SYSTEM_OPENGL_ENABLED
+}
+
+System::~System()
+{
+    if (mPrewarmThread.joinable()) {
+        mPrewarmThread.join();
+    }
+    mFontAtlas.reset();
+    #ifdef DYNAMIC_STATIC_SYSTEM_OPENGL_ENABLED
+    mShareWindow.reset();
+    #endif // DYNAMIC_STATIC_SYSTEM_OPENGL_ENABLED
+    Window::access_registry(
+        [](Window::Registry&)
+        {
+            Window::release_glfw();
+        }
+    );
+}
+
+void System::begin_prewarm(std::vector<std::function<void()>> tasks)
+{
+    assert(!mPrewarmThread.joinable());
+    mFontAtlasReady = false;
+    mPrewarmException = nullptr;
+    mPrewarmThread = std::thread(&System::prewarm, this, std::move(tasks));
+}
+
+void System::end_prewarm()
+{
+    join_prewarm();
+    if (mPrewarmException) {
+        std::rethrow_exception(std::exchange(mPrewarmException, nullptr));
+    }
+}
+
+ImFontAtlas* System::get_font_atlas()
+{
+    return mFontAtlasReady ? mFontAtlas.get() : nullptr;
+}
+
+const std::vector<System::Monitor>& System::get_monitors() const
+{
+    return mMonitors;
+}
+
+double System::get_phase_time(Phase phase) const
+{
+    assert(phase < Phase::Count);
+    return mPhaseTimes[(size_t)phase];
+}
+
+#ifdef DYNAMIC_STATIC_SYSTEM_OPENGL_ENABLED
+const Window* System::get_share_window()
+{
+    join_prewarm();
+    return mShareWindow.get();
+}
+#endif // DYNAMIC_STATIC_SYSTEM_OPENGL_ENABLED
+
+void System::join_prewarm()
+{
+    if (mPrewarmThread.joinable()) {
+        mPrewarmThread.join();
+        mFontAtlasReady = mFontAtlas != nullptr;
+    }
+}
+
+void System::prewarm(std::vector<std::function<void()>> tasks)
+{
+    auto begin = dst::HighResolutionClock::now();
+    try {
+        if ((int)(mInfo.flags & Info::Flags::PrewarmFontAtlas) && !mFontAtlas) {
+            int fontWidth = 0;
+            int fontHeight = 0;
+            unsigned char* pFontData = nullptr;
+            auto fontAtlas = std::make_unique<ImFontAtlas>();
+            fontAtlas->GetTexDataAsAlpha8(&pFontData, &fontWidth, &fontHeight);
+            mFontAtlas = std::move(fontAtlas);
+        }
+        #ifdef DYNAMIC_STATIC_SYSTEM_OPENGL_ENABLED
+        if (mShareWindow) {
+            mShareWindow->make_context_current();
+        }
+        #endif // DYNAMIC_STATIC_SYSTEM_OPENGL_ENABLED
+        for (auto& task : tasks) {
+            if (task) {
+                task();
+            }
+        }
+    } catch (...) {
+        mPrewarmException = std::current_exception();
+    }
+    #ifdef DYNAMIC_STATIC_SYSTEM_OPENGL_ENABLED
+    if (mShareWindow) {
+        // NOTE : glFinish() ensures objects created by prewarm tasks are complete
+        //  before they're used by other contexts in the share group.
+        glFinish();
+        glfwMakeContextCurrent(nullptr);
+    }
+    #endif // DYNAMIC_STATIC_SYSTEM_OPENGL_ENABLED
+    mPhaseTimes[(size_t)Phase::Prewarm] = dst::duration_cast<dst::Seconds<double>>(dst::HighResolutionClock::now() - begin).count();
+}
+
+} // namespace sys
+} // namespace dst
@@ -0,0 +1,257 @@
+
+/*
+==========================================
+  Copyright (c) 2020 Dynamic_Static
+    Patrick Purcell
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#include "dynamic_static/system/task-graph.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <stdexcept>
+#include <utility>
+
+namespace dst {
+namespace sys {
+
+static thread_local const TaskGraph* tlpTaskGraph { nullptr };
+static thread_local size_t tlWorkerIndex { 0 };
+
+TaskGraph::TaskGraph(uint32_t workerCount)
+{
+    if (!workerCount) {
+        workerCount = std::max(1u, std::thread::hardware_concurrency()) - 1;
+    }
+    mWorkers.reserve(workerCount);
+    for (uint32_t worker_i = 0; worker_i < workerCount; ++worker_i) {
+        mWorkers.push_back(std::make_unique<Worker>());
+    }
+    mThreads.reserve(workerCount);
+    for (uint32_t worker_i = 0; worker_i < workerCount; ++worker_i) {
+        mThreads.emplace_back(&TaskGraph::process_tasks, this, (size_t)worker_i);
+    }
+}
+
+TaskGraph::~TaskGraph()
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStop = true;
+    }
+    mConditionVariable.notify_all();
+    for (auto& thread : mThreads) {
+        thread.join();
+    }
+}
+
+uint32_t TaskGraph::get_worker_count() const
+{
+    return (uint32_t)mWorkers.size();
+}
+
+TaskGraph::Task TaskGraph::add_task(std::function<void()> function, Affinity affinity)
+{
+    assert(!mRemainingTaskCount);
+    mNodes.emplace_back();
+    mNodes.back().function = std::move(function);
+    mNodes.back().affinity = affinity;
+    mValidated = false;
+    return (Task)(mNodes.size() - 1);
+}
+
+void TaskGraph::add_dependency(Task task, Task dependency)
+{
+    assert(!mRemainingTaskCount);
+    assert(task < mNodes.size());
+    assert(dependency < mNodes.size());
+    assert(task != dependency);
+    mNodes[dependency].dependents.push_back(task);
+    ++mNodes[task].dependencyCount;
+    mValidated = false;
+}
+
+void TaskGraph::clear()
+{
+    assert(!mRemainingTaskCount);
+    mNodes.clear();
+    mValidated = false;
+}
+
+void TaskGraph::run()
+{
+    validate();
+    if (mNodes.empty()) {
+        return;
+    }
+    if (mPendingDependencyCountCapacity < mNodes.size()) {
+        mPendingDependencyCountCapacity = mNodes.size();
+        mPendingDependencyCounts = std::make_unique<std::atomic<uint32_t>[]>(mPendingDependencyCountCapacity);
+    }
+    for (size_t node_i = 0; node_i < mNodes.size(); ++node_i) {
+        mPendingDependencyCounts[node_i] = mNodes[node_i].dependencyCount;
+    }
+    mFailed = false;
+    mException = nullptr;
+    mRemainingTaskCount = mNodes.size();
+    auto pPreviousTaskGraph = std::exchange(tlpTaskGraph, this);
+    auto previousWorkerIndex = std::exchange(tlWorkerIndex, mWorkers.size());
+    for (size_t node_i = 0; node_i < mNodes.size(); ++node_i) {
+        if (!mNodes[node_i].dependencyCount) {
+            enqueue((Task)node_i);
+        }
+    }
+    while (mRemainingTaskCount) {
+        auto task = InvalidTask;
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            if (!mCallerTasks.empty()) {
+                task = mCallerTasks.front();
+                mCallerTasks.pop_front();
+            }
+        }
+        if (task == InvalidTask && !dequeue(mWorkers.size(), &task)) {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mConditionVariable.wait(lock, [this]() { return !mRemainingTaskCount || !mCallerTasks.empty() || mQueuedTaskCount; });
+            continue;
+        }
+        execute(task);
+    }
+    tlpTaskGraph = pPreviousTaskGraph;
+    tlWorkerIndex = previousWorkerIndex;
+    if (mException) {
+        std::rethrow_exception(std::exchange(mException, nullptr));
+    }
+}
+
+void TaskGraph::validate()
+{
+    if (!mValidated) {
+        // NOTE : Kahn's algorithm, if every node can't be visited in dependency
+        //  order then at least one cycle exists.
+        std::vector<uint32_t> dependencyCounts(mNodes.size());
+        std::vector<Task> readyTasks;
+        for (size_t node_i = 0; node_i < mNodes.size(); ++node_i) {
+            dependencyCounts[node_i] = mNodes[node_i].dependencyCount;
+            if (!dependencyCounts[node_i]) {
+                readyTasks.push_back((Task)node_i);
+            }
+        }
+        size_t visitedCount = 0;
+        while (!readyTasks.empty()) {
+            auto task = readyTasks.back();
+            readyTasks.pop_back();
+            ++visitedCount;
+            for (auto dependent : mNodes[task].dependents) {
+                if (!--dependencyCounts[dependent]) {
+                    readyTasks.push_back(dependent);
+                }
+            }
+        }
+        if (visitedCount != mNodes.size()) {
+            throw std::runtime_error("Failed to run TaskGraph : Dependencies contain a cycle");
+        }
+        mValidated = true;
+    }
+}
+
+void TaskGraph::enqueue(Task task)
+{
+    if (mNodes[task].affinity == Affinity::Caller || mWorkers.empty()) {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mCallerTasks.push_back(task);
+        }
+        mConditionVariable.notify_all();
+    } else {
+        // NOTE : Workers push onto their own deque so dependents stay on the core
+        //  that produced their inputs, other threads distribute round robin.
+        auto worker_i = tlpTaskGraph == this && tlWorkerIndex < mWorkers.size() ? tlWorkerIndex : mNextWorker++ % mWorkers.size();
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            ++mQueuedTaskCount;
+        }
+        {
+            std::lock_guard<std::mutex> lock(mWorkers[worker_i]->mutex);
+            mWorkers[worker_i]->tasks.push_back(task);
+        }
+        mConditionVariable.notify_one();
+    }
+}
+
+bool TaskGraph::dequeue(size_t worker_i, Task* pTask)
+{
+    assert(pTask);
+    if (worker_i < mWorkers.size()) {
+        auto& worker = *mWorkers[worker_i];
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        if (!worker.tasks.empty()) {
+            *pTask = worker.tasks.back();
+            worker.tasks.pop_back();
+            --mQueuedTaskCount;
+            return true;
+        }
+    }
+    for (size_t i = 1; i <= mWorkers.size(); ++i) {
+        auto& worker = *mWorkers[(worker_i + i) % mWorkers.size()];
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        if (!worker.tasks.empty()) {
+            *pTask = worker.tasks.front();
+            worker.tasks.pop_front();
+            --mQueuedTaskCount;
+            return true;
+        }
+    }
+    return false;
+}
+
+void TaskGraph::execute(Task task)
+{
+    auto& node = mNodes[task];
+    if (!mFailed && node.function) {
+        try {
+            node.function();
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(mMutex);
+            if (!mException) {
+                mException = std::current_exception();
+            }
+            mFailed = true;
+        }
+    }
+    for (auto dependent : node.dependents) {
+        if (!--mPendingDependencyCounts[dependent]) {
+            enqueue(dependent);
+        }
+    }
+    if (!--mRemainingTaskCount) {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+        }
+        mConditionVariable.notify_all();
+    }
+}
+
+void TaskGraph::process_tasks(size_t worker_i)
+{
+    tlpTaskGraph = this;
+    tlWorkerIndex = worker_i;
+    while (true) {
+        auto task = InvalidTask;
+        if (dequeue(worker_i, &task)) {
+            execute(task);
+        } else {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mConditionVariable.wait(lock, [this]() { return mStop || mQueuedTaskCount; });
+            if (mStop) {
+                break;
+            }
+        }
+    }
+}
+
+} // namespace sys
+} // namespace dst
@@ -0,0 +1,102 @@
+
+/*
+==========================================
+  Copyright (c) 2020 Dynamic_Static
+    Patrick Purcell
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#include "dynamic_static/system/text-stream.hpp"
+
+#include <cassert>
+
+namespace dst {
+namespace sys {
+
+bool TextStream::push(uint32_t codepoint)
+{
+    if (!codepoint || (0xD800 <= codepoint && codepoint <= 0xDFFF) || 0x10FFFF < codepoint) {
+        return false;
+    }
+    if (mCodepointCount == mCodepoints.size()) {
+        ++mOverflowCount;
+        return false;
+    }
+    mCodepoints[mCodepointCount++] = codepoint;
+    assert(mUtf8Size + 4 < mUtf8.size());
+    auto pUtf8 = &mUtf8[mUtf8Size];
+    if (codepoint < 0x80) {
+        pUtf8[0] = (char)codepoint;
+        mUtf8Size += 1;
+    } else if (codepoint < 0x800) {
+        pUtf8[0] = (char)(0xC0 | (codepoint >> 6));
+        pUtf8[1] = (char)(0x80 | (codepoint & 0x3F));
+        mUtf8Size += 2;
+    } else if (codepoint < 0x10000) {
+        pUtf8[0] = (char)(0xE0 | (codepoint >> 12));
+        pUtf8[1] = (char)(0x80 | ((codepoint >> 6) & 0x3F));
+        pUtf8[2] = (char)(0x80 | (codepoint & 0x3F));
+        mUtf8Size += 3;
+    } else {
+        pUtf8[0] = (char)(0xF0 | (codepoint >> 18));
+        pUtf8[1] = (char)(0x80 | ((codepoint >> 12) & 0x3F));
+        pUtf8[2] = (char)(0x80 | ((codepoint >> 6) & 0x3F));
+        pUtf8[3] = (char)(0x80 | (codepoint & 0x3F));
+        mUtf8Size += 4;
+    }
+    mUtf8[mUtf8Size] = '\0';
+    return true;
+}
+
+dst::Span<const uint32_t> TextStream::get_codepoints() const
+{
+    return { mCodepoints.data(), mCodepointCount };
+}
+
+const char* TextStream::get_utf8() const
+{
+    return mUtf8.data();
+}
+
+size_t TextStream::get_utf8_size() const
+{
+    return mUtf8Size;
+}
+
+size_t TextStream::get_overflow_count() const
+{
+    return mOverflowCount;
+}
+
+size_t TextStream::size() const
+{
+    return mCodepointCount;
+}
+
+bool TextStream::empty() const
+{
+    return !mCodepointCount;
+}
+
+const uint32_t* TextStream::begin() const
+{
+    return mCodepoints.data();
+}
+
+const uint32_t* TextStream::end() const
+{
+    return mCodepoints.data() + mCodepointCount;
+}
+
+void TextStream::clear()
+{
+    mCodepointCount = 0;
+    mUtf8Size = 0;
+    mUtf8[0] = '\0';
+    mOverflowCount = 0;
+}
+
+} // namespace sys
+} // namespace dst
@@ -0,0 +1,136 @@
+
+/*
+==========================================
+  Copyright (c) 2020 Dynamic_Static
+    Patrick Purcell
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#pragma once
+
+#include "dynamic_static/system/window.hpp"
+
+#include <cassert>
+#include <vector>
+
+namespace dst {
+namespace sys {
+
+/**
+Provides O(1) generation checked lookup and dense iteration of live Windows
+    @note Access to the Window::Registry is synchronized via Window::access_registry()
+*/
+class Window::Registry final
+{
+public:
+    /**
+    Inserts a given Window into this Window::Registry
+    @param [in] pWindow The Window to insert
+    @return The Handle of the inserted Window
+    */
+    inline Handle insert(Window* pWindow)
+    {
+        assert(pWindow);
+        uint32_t slotIndex = 0;
+        if (mFreeSlots.empty()) {
+            slotIndex = (uint32_t)mSlots.size();
+            mSlots.emplace_back();
+        } else {
+            slotIndex = mFreeSlots.back();
+            mFreeSlots.pop_back();
+        }
+        auto& slot = mSlots[slotIndex];
+        slot.denseIndex = (uint32_t)mWindows.size();
+        mWindows.push_back(pWindow);
+        mDenseSlots.push_back(slotIndex);
+        return { slotIndex, slot.generation };
+    }
+
+    /**
+    Erases the Window identified by a given Handle from this Window::Registry
+        @note Handles to the erased Window are invalidated, this method does nothing if the given Handle is invalid
+    @param [in] handle The Handle of the Window to erase
+    */
+    inline void erase(const Handle& handle)
+    {
+        if (contains(handle)) {
+            auto& slot = mSlots[handle.index];
+            auto lastDenseIndex = (uint32_t)mWindows.size() - 1;
+            mWindows[slot.denseIndex] = mWindows[lastDenseIndex];
+            mDenseSlots[slot.denseIndex] = mDenseSlots[lastDenseIndex];
+            mSlots[mDenseSlots[slot.denseIndex]].denseIndex = slot.denseIndex;
+            mWindows.pop_back();
+            mDenseSlots.pop_back();
+            ++slot.generation;
+            mFreeSlots.push_back(handle.index);
+        }
+    }
+
+    /**
+    Gets a value indicating whether or not a given Handle identifies a Window in this Window::Registry
+    @param [in] handle The Handle to check
+    @return Whether or not the given Handle identifies a Window in this Window::Registry
+    */
+    inline bool contains(const Handle& handle) const
+    {
+        return handle.index < mSlots.size() && mSlots[handle.index].generation == handle.generation;
+    }
+
+    /**
+    Gets the Window identified by a given Handle
+    @param [in] handle The Handle of the Window to get
+    @return The Window identified by the given Handle, or nullptr if the Handle is invalid
+    */
+    inline Window* get(const Handle& handle) const
+    {
+        return contains(handle) ? mWindows[mSlots[handle.index].denseIndex] : nullptr;
+    }
+
+    /**
+    Sets the Window identified by a given Handle
+        @note This method must be called when a registered Window is moved
+    @param [in] handle The Handle of the Window to set
+    @param [in] pWindow The Window to set
+    */
+    inline void set(const Handle& handle, Window* pWindow)
+    {
+        if (contains(handle)) {
+            mWindows[mSlots[handle.index].denseIndex] = pWindow;
+        }
+    }
+
+    /**
+    Gets this Window::Registry object's Windows
+    @return This Window::Registry object's Windows
+    */
+    inline const std::vector<Window*>& get_windows() const
+    {
+        return mWindows;
+    }
+
+    /**
+    Gets a value indicating whether or not this Window::Registry is empty
+    @return Whether or not this Window::Registry is empty
+    */
+    inline bool empty() const
+    {
+        return mWindows.empty();
+    }
+
+private:
+    struct Slot final
+    {
+        uint32_t generation { 0 };
+        uint32_t denseIndex { 0 };
+    };
+
+    std::vector<Slot> mSlots;
+    std::vector<uint32_t> mFreeSlots;
+    std::vector<Window*> mWindows;
+    std::vector<uint32_t> mDenseSlots;
+};
+
+} // namespace sys
+} // namespace dst
@@ -9,26 +9,87 @@
 */
 
 #include "dynamic_static/system/window.hpp"
+#include "window-registry.hpp"
+#include "egl-context.hpp"
 #include "glfw-window.hpp"
 
 #include <mutex>
+#include <stdexcept>
 #include <utility>
 
 namespace dst {
 namespace sys {
 
 std::mutex Window::sMutex;
-std::set<GLFWwindow*> Window::sGlfwWindows;
+Window::Registry Window::sRegistry;
+uint32_t Window::sGlfwReferenceCount;
+std::shared_ptr<Gamepad::Source> Window::sGamepadSource;
+Gamepad::Response Window::sGamepadStickResponse;
+Gamepad::Response Window::sGamepadTriggerResponse { 0.05f, 0.95f, 0 };
+Gamepad::State Window::sGamepadState;
+#if defined(DYNAMIC_STATIC_SYSTEM_OPENGL_ENABLED) && defined(DYNAMIC_STATIC_PLATFORM_LINUX)
+EGLDisplay Window::EglContext::sEglDisplay { EGL_NO_DISPLAY };
+bool Window::EglContext::sEglSurfaceless { false };
+uint32_t Window::EglContext::sEglDisplayReferenceCount { 0 };
+#endif // defined(DYNAMIC_STATIC_SYSTEM_OPENGL_ENABLED) && defined(DYNAMIC_STATIC_PLATFORM_LINUX)
 
 Window::Window(const Info& info)
+    : Window(nullptr, info)
+{
+}
+
+Window::Window(Window* pParent, const Info& info)
     : mInfo { info }
     , mName { info.pName ? info.pName : "Dynamic_Static" }
+    , mpParent { pParent }
 {
     mInfo.pName = mName.c_str();
-    mGlfwWindow = create_glfw_window(info);
-    if (mGlfwWindow) {
-        glfwSetWindowUserPointer(mGlfwWindow, this);
-        glfwGetFramebufferSize(mGlfwWindow, &mInfo.extent.x, &mInfo.extent.y);
+    access_registry(
+        [&](Registry& registry)
+        {
+            if ((int)(info.flags & Info::Flags::Headless)) {
+                #if defined(DYNAMIC_STATIC_SYSTEM_OPENGL_ENABLED) && defined(DYNAMIC_STATIC_PLATFORM_LINUX)
+                if (!info.pGlInfo) {
+                    throw std::runtime_error("Failed to create headless Window : Window::Info::pGlInfo is required");
+                }
+                const EglContext* pShareContext = nullptr;
+                if (info.pShareWindow) {
+                    pShareContext = info.pShareWindow->mEglContext.get();
+                    if (!pShareContext) {
+                        throw std::runtime_error("Failed to create headless Window : Window::Info::pShareWindow must be a headless Window");
+                    }
+                }
+                mEglContext = std::make_unique<EglContext>(mInfo, pShareContext);
+                #else
+                throw std::runtime_error("Failed to create headless Window : Headless Windows are only supported on Linux with OpenGL enabled");
+                #endif
+            } else {
+                mGlfwWindow = create_glfw_window(registry, info);
+                glfwSetWindowUserPointer(mGlfwWindow, this);
+            }
+            mHandle = registry.insert(this);
+        }
+    );
+    // NOTE : The destructor won't run if construction throws, so this Window is
+    //  destroyed here to remove it from the Registry and release its resources.
+    try {
+        if (mGlfwWindow) {
+            glfwGetFramebufferSize(mGlfwWindow, &mInfo.extent.x, &mInfo.extent.y);
+            mFocused = glfwGetWindowAttrib(mGlfwWindow, GLFW_FOCUSED) == GLFW_TRUE;
+            mIconified = glfwGetWindowAttrib(mGlfwWindow, GLFW_ICONIFIED) == GLFW_TRUE;
+            set_raw_mouse_motion((int)(mInfo.flags & Info::Flags::RawMouseMotion));
+        }
+        #ifdef DYNAMIC_STATIC_SYSTEM_OPENGL_ENABLED
+        if (mInfo.pGlInfo) {
+            auto flags = mInfo.pGlInfo->flags;
+            set_swap_interval((int)(flags & GlInfo::Flags::AdaptiveVSync) ? -1 : (int)(flags & GlInfo::Flags::VSync) ? 1 : 0);
+            mFramePacer.set_target_frame_time(mInfo.pGlInfo->targetFrameTime);
+            set_max_frames_in_flight(mInfo.pGlInfo->maxFramesInFlight);
+        }
+        #endif // DYNAMIC_STATIC_SYSTEM_OPENGL_ENABLED
+    } catch (...) {
+        destroy();
+        throw;
     }
 }
 
@@ -39,20 +100,63 @@ Window::Window(Window&& other) noexcept
 
 Window::~Window()
 {
-    destroy_glfw_window(mGlfwWindow);
+    destroy();
 }
 
 Window& Window::operator=(Window&& other) noexcept
 {
     assert(this != &other);
+    // NOTE : This Window object's own resources are released before taking
+    //  other's so its Registry slot doesn't outlive it.
+    destroy();
+    mHandle = std::move(other.mHandle);
     mInfo = std::move(other.mInfo);
     mInput = std::move(other.mInput);
+    mFrameStats = std::move(other.mFrameStats);
+    mLatencyStats = std::move(other.mLatencyStats);
+    mInputRecorder = std::move(other.mInputRecorder);
+    mInputReplayer = std::move(other.mInputReplayer);
     mTextStream = std::move(other.mTextStream);
+    mFrameAllocator = std::move(other.mFrameAllocator);
     mName = std::move(other.mName);
+    mInfo.pName = mName.c_str();
     mGlfwWindow = std::move(other.mGlfwWindow);
+    mpParent = other.mpParent;
     mChildren = std::move(other.mChildren);
+    for (auto& child : mChildren) {
+        child->mpParent = this;
+    }
+    #ifdef DYNAMIC_STATIC_SYSTEM_OPENGL_ENABLED
+    #ifdef DYNAMIC_STATIC_PLATFORM_LINUX
+    mEglContext = std::move(other.mEglContext);
+    #endif // DYNAMIC_STATIC_PLATFORM_LINUX
+    mFramePacer = std::move(other.mFramePacer);
+    mSwapInterval = other.mSwapInterval;
+    mAppliedSwapInterval = other.mAppliedSwapInterval;
+    mFrameFences = std::move(other.mFrameFences);
+    mFrameFenceIndex = other.mFrameFenceIndex;
+    other.mFrameFences.clear();
+    #endif // DYNAMIC_STATIC_SYSTEM_OPENGL_ENABLED
+    mFocused = other.mFocused;
+    mIconified = other.mIconified;
+    mLatencyPending = other.mLatencyPending;
+    mResized = other.mResized;
+    mResizeSettling = other.mResizeSettling;
+    mResizeTimePoint = other.mResizeTimePoint;
+    mCloseRequested = other.mCloseRequested;
+    mPolledGamepadState = other.mPolledGamepadState;
+    other.mHandle = { };
     other.mGlfwWindow = nullptr;
-    glfwSetWindowUserPointer(mGlfwWindow, this);
+    other.mpParent = nullptr;
+    access_registry(
+        [&](Registry& registry)
+        {
+            registry.set(mHandle, this);
+        }
+    );
+    if (mGlfwWindow) {
+        glfwSetWindowUserPointer(mGlfwWindow, this);
+    }
     return *this;
 }
 
@@ -63,20 +167,15 @@ const Window::Info& Window::get_info() const
 
 const Window* Window::get_parent() const
 {
-    return (const Window*)glfwGetWindowUserPointer(mParentGlfwWindow);
+    return mpParent;
 }
 
 Window* Window::get_parent()
 {
-    return (Window*)glfwGetWindowUserPointer(mParentGlfwWindow);
-}
-
-dst::Span<const Window> Window::get_children() const
-{
-    return mChildren;
+    return mpParent;
 }
 
-dst::Span<Window> Window::get_children()
+dst::Span<const std::unique_ptr<Window>> Window::get_children() const
 {
     return mChildren;
 }
@@ -91,34 +190,133 @@ Input& Window::get_input()
     return mInput;
 }
 
-dst::Span<const uint32_t> Window::get_text_stream() const
+const TextStream& Window::get_text_stream() const
 {
     return mTextStream;
 }
 
+FrameAllocator& Window::frame_allocator()
+{
+    return mFrameAllocator;
+}
+
+const FrameStats& Window::get_frame_stats() const
+{
+    return mFrameStats;
+}
+
+FrameStats& Window::get_frame_stats()
+{
+    return mFrameStats;
+}
+
+const LatencyStats& Window::get_latency_stats() const
+{
+    return mLatencyStats;
+}
+
+LatencyStats& Window::get_latency_stats()
+{
+    return mLatencyStats;
+}
+
+bool Window::is_focused() const
+{
+    return mFocused;
+}
+
+bool Window::is_iconified() const
+{
+    return mIconified;
+}
+
+bool Window::is_background() const
+{
+    return mGlfwWindow && (mIconified || !mFocused || glfwGetWindowAttrib(mGlfwWindow, GLFW_VISIBLE) == GLFW_FALSE);
+}
+
+bool Window::is_recording_input() const
+{
+    return mInputRecorder.is_open();
+}
+
+void Window::begin_input_recording(const std::filesystem::path& filePath)
+{
+    mInputRecorder = InputRecorder(filePath);
+    mInput.reset();
+    mPolledGamepadState.reset();
+    Input::Event event { };
+    event.type = Input::Event::Type::Resize;
+    event.value = { (double)mInfo.extent.x, (double)mInfo.extent.y };
+    event.timestamp = dst::HighResolutionClock::now();
+    mInputRecorder.write(event);
+}
+
+void Window::end_input_recording()
+{
+    mInputRecorder.close();
+}
+
+bool Window::is_replaying_input() const
+{
+    return mInputReplayer.is_open();
+}
+
+void Window::begin_input_replay(const std::filesystem::path& filePath)
+{
+    mInputReplayer = InputReplayer(filePath);
+    mInput.reset();
+    mPolledGamepadState.reset();
+}
+
+void Window::end_input_replay()
+{
+    mInputReplayer.close();
+}
+
 #ifdef DYNAMIC_STATIC_PLATFORM_WINDOWS
 void* Window::get_hwnd() const
 {
-    return glfwGetWin32Window(mGlfwWindow);
+    return mGlfwWindow ? glfwGetWin32Window(mGlfwWindow) : nullptr;
 }
 #endif // DYNAMIC_STATIC_PLATFORM_WINDOWS
 
 std::string Window::get_clipboard() const
 {
-    auto pClipboard = glfwGetClipboardString(mGlfwWindow);
+    auto pClipboard = mGlfwWindow ? glfwGetClipboardString(mGlfwWindow) : nullptr;
     return pClipboard ? pClipboard : std::string();
 }
 
 void Window::set_clipboard(const std::string& clipboard)
 {
-    glfwSetClipboardString(mGlfwWindow, clipboard.c_str());
+    if (mGlfwWindow) {
+        glfwSetClipboardString(mGlfwWindow, clipboard.c_str());
+    }
 }
 
 void Window::set_name(const std::string& name)
 {
     mName = name;
     mInfo.pName = mName.c_str();
-    glfwSetWindowTitle(mGlfwWindow, mName.c_str());
+    if (mGlfwWindow) {
+        glfwSetWindowTitle(mGlfwWindow, mName.c_str());
+    }
+}
+
+void Window::set_extent(const glm::ivec2& extent)
+{
+    assert(0 < extent.x && 0 < extent.y);
+    if (mGlfwWindow) {
+        glfwSetWindowSize(mGlfwWindow, extent.x, extent.y);
+    } else if (extent != mInfo.extent) {
+        // NOTE : Headless Windows have no system to report the new extent so
+        //  the Resize is processed as if it had been received from the system.
+        Input::Event event { };
+        event.type = Input::Event::Type::Resize;
+        event.value = { (double)extent.x, (double)extent.y };
+        event.timestamp = dst::HighResolutionClock::now();
+        process_glfw_event(event);
+    }
 }
 
 void Window::set_cursor_mode(CursorMode cursorMode)
@@ -131,58 +329,379 @@ void Window::set_cursor_mode(CursorMode cursorMode)
     case CursorMode::Disabled: glfwCursorMode = GLFW_CURSOR_DISABLED; break;
     default: assert(false); break;
     }
-    glfwSetInputMode(mGlfwWindow, GLFW_CURSOR, glfwCursorMode);
+    if (mGlfwWindow) {
+        glfwSetInputMode(mGlfwWindow, GLFW_CURSOR, glfwCursorMode);
+    }
+}
+
+void Window::set_raw_mouse_motion(bool rawMouseMotion)
+{
+    mInfo.flags = rawMouseMotion ? mInfo.flags | Info::Flags::RawMouseMotion : mInfo.flags & ~Info::Flags::RawMouseMotion;
+    if (mGlfwWindow && glfwRawMouseMotionSupported() == GLFW_TRUE) {
+        glfwSetInputMode(mGlfwWindow, GLFW_RAW_MOUSE_MOTION, rawMouseMotion ? GLFW_TRUE : GLFW_FALSE);
+    }
 }
 
 Window* Window::create_child(const Info& info)
 {
-    assert(false && "Not yet implemented");
-    return nullptr;
+    auto childInfo = info;
+    #ifdef DYNAMIC_STATIC_SYSTEM_OPENGL_ENABLED
+    if (childInfo.pGlInfo && !childInfo.pShareWindow) {
+        childInfo.pShareWindow = this;
+    }
+    #ifdef DYNAMIC_STATIC_PLATFORM_LINUX
+    if (mEglContext) {
+        childInfo.flags |= Info::Flags::Headless;
+    }
+    #endif // DYNAMIC_STATIC_PLATFORM_LINUX
+    #endif // DYNAMIC_STATIC_SYSTEM_OPENGL_ENABLED
+    mChildren.push_back(std::unique_ptr<Window>(new Window(this, childInfo)));
+    return mChildren.back().get();
 }
 
 void Window::focus() const
 {
-    glfwFocusWindow(mGlfwWindow);
+    if (mGlfwWindow) {
+        glfwFocusWindow(mGlfwWindow);
+    }
 }
 
 #ifdef DYNAMIC_STATIC_SYSTEM_OPENGL_ENABLED
 void Window::make_context_current()
 {
-    if (mInfo.pGlInfo) {
+    #ifdef DYNAMIC_STATIC_PLATFORM_LINUX
+    if (mEglContext) {
+        mEglContext->make_current();
+    } else
+    #endif // DYNAMIC_STATIC_PLATFORM_LINUX
+    if (mInfo.pGlInfo && mGlfwWindow) {
         glfwMakeContextCurrent(mGlfwWindow);
     }
 }
 
 void Window::swap()
 {
+    swap(mSwapInterval, true);
+}
+
+void Window::present(dst::Span<Window* const> windows)
+{
+    dst_allocation_scope("sys::Window::present");
+    // NOTE : Every Window's commands are submitted before any Window swaps so
+    //  that no Window's rendering waits on another Window's vertical blank.
+    //  Only one Window is synchronized to the vertical blank, the rest swap
+    //  immediately after it with an interval of 0 so they don't block again.
+    Window* pSynchronizedWindow = nullptr;
+    for (auto pWindow : windows) {
+        if (pWindow && pWindow->mInfo.pGlInfo) {
+            pWindow->make_context_current();
+            dst_gl(glFlush());
+            if (!pSynchronizedWindow && pWindow->mGlfwWindow && pWindow->mSwapInterval) {
+                pSynchronizedWindow = pWindow;
+            }
+        }
+    }
+    if (pSynchronizedWindow) {
+        pSynchronizedWindow->swap(pSynchronizedWindow->mSwapInterval, true);
+    }
+    for (auto pWindow : windows) {
+        if (pWindow && pWindow->mInfo.pGlInfo && pWindow != pSynchronizedWindow) {
+            pWindow->swap(0, !pSynchronizedWindow);
+        }
+    }
+}
+
+void Window::apply_swap_interval(int swapInterval)
+{
+    if (mGlfwWindow && mAppliedSwapInterval != swapInterval) {
+        glfwSwapInterval(swapInterval);
+        mAppliedSwapInterval = swapInterval;
+    }
+}
+
+void Window::swap(int swapInterval, bool pace)
+{
+    dst_allocation_scope("sys::Window::swap");
     if (mInfo.pGlInfo) {
-        glfwSwapBuffers(mGlfwWindow);
+        // NOTE : glfwSwapInterval() and the frame fence apply to the current
+        //  context, so this Window object's context is made current first.
+        make_context_current();
+        {
+            FrameStats::ScopedPhase swapPhase(mFrameStats, FrameStats::Phase::Swap);
+            if (pace) {
+                mFramePacer.wait();
+            }
+            if (mGlfwWindow) {
+                apply_swap_interval(swapInterval);
+                glfwSwapBuffers(mGlfwWindow);
+            } else {
+                dst_gl(glFlush());
+            }
+            if ((int)(mInfo.pGlInfo->flags & GlInfo::Flags::FinishAfterSwap)) {
+                dst_gl(glFinish());
+            }
+            if (!mFrameFences.empty()) {
+                dst_gl(mFrameFences[mFrameFenceIndex] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+                mFrameFenceIndex = (mFrameFenceIndex + 1) % mFrameFences.size();
+                auto& frameFence = mFrameFences[mFrameFenceIndex];
+                if (frameFence) {
+                    // NOTE : GL_SYNC_FLUSH_COMMANDS_BIT is only needed on the first wait,
+                    //  the wait is repeated until the fence signals or the wait fails.
+                    GLbitfield waitFlags = GL_SYNC_FLUSH_COMMANDS_BIT;
+                    GLenum waitResult = GL_TIMEOUT_EXPIRED;
+                    while (waitResult == GL_TIMEOUT_EXPIRED) {
+                        dst_gl(waitResult = glClientWaitSync(frameFence, waitFlags, 1000000000));
+                        waitFlags = 0;
+                    }
+                    dst_gl(glDeleteSync(frameFence));
+                    frameFence = nullptr;
+                }
+            }
+        }
+        if (mLatencyPending) {
+            auto presentTimePoint = dst::HighResolutionClock::now();
+            for (const auto& event : mInput.get_events()) {
+                mLatencyStats.record(event, presentTimePoint);
+            }
+            mLatencyPending = false;
+        }
+        mFrameStats.end_frame();
+    }
+}
+
+GLuint Window::get_framebuffer() const
+{
+    #ifdef DYNAMIC_STATIC_PLATFORM_LINUX
+    if (mEglContext) {
+        return mEglContext->get_framebuffer();
+    }
+    #endif // DYNAMIC_STATIC_PLATFORM_LINUX
+    return 0;
+}
+
+int Window::get_swap_interval() const
+{
+    return mSwapInterval;
+}
+
+void Window::set_swap_interval(int swapInterval)
+{
+    if (mInfo.pGlInfo && mGlfwWindow) {
+        make_context_current();
+        if (swapInterval < 0 && !glfwExtensionSupported("WGL_EXT_swap_control_tear") && !glfwExtensionSupported("GLX_EXT_swap_control_tear")) {
+            swapInterval = -swapInterval;
+        }
+        glfwSwapInterval(swapInterval);
+        mSwapInterval = swapInterval;
+        mAppliedSwapInterval = swapInterval;
+    }
+}
+
+const FramePacer& Window::get_frame_pacer() const
+{
+    return mFramePacer;
+}
+
+FramePacer& Window::get_frame_pacer()
+{
+    return mFramePacer;
+}
+
+uint32_t Window::get_max_frames_in_flight() const
+{
+    return (uint32_t)mFrameFences.size();
+}
+
+void Window::set_max_frames_in_flight(uint32_t maxFramesInFlight)
+{
+    if (mInfo.pGlInfo && maxFramesInFlight != mFrameFences.size()) {
+        make_context_current();
+        for (auto frameFence : mFrameFences) {
+            if (frameFence) {
+                dst_gl(glDeleteSync(frameFence));
+            }
+        }
+        mFrameFences.assign(maxFramesInFlight, nullptr);
+        mFrameFenceIndex = 0;
     }
 }
 #endif // DYNAMIC_STATIC_SYSTEM_OPENGL_ENABLED
 
 void Window::poll_events()
 {
-    access_glfw_windows(
-        [](const auto& glfwWindows)
+    process_events(
+        [](const auto& registry, double* pTimeout)
         {
-            for (auto pGlfwWindow : glfwWindows) {
-                auto pWindow = (Window*)glfwGetWindowUserPointer(pGlfwWindow);
-                assert(pWindow);
-                if (pWindow) {
-                    pWindow->mTextStream.clear();
-                }
-            }
-            glfwPollEvents();
-            for (auto pGlfwWindow : glfwWindows) {
-                auto pWindow = (Window*)glfwGetWindowUserPointer(pGlfwWindow);
-                assert(pWindow);
-                if (pWindow) {
-                    pWindow->mInput.update();
-                }
+            return get_background_wait_timeout(registry, pTimeout);
+        }
+    );
+}
+
+void Window::wait_events()
+{
+    process_events(
+        [](const auto&, double* pTimeout)
+        {
+            *pTimeout = 0;
+            return true;
+        }
+    );
+}
+
+void Window::wait_events(double timeout)
+{
+    process_events(
+        [timeout](const auto&, double* pTimeout)
+        {
+            *pTimeout = timeout;
+            return 0 < timeout;
+        }
+    );
+}
+
+void Window::post_empty_event()
+{
+    glfwPostEmptyEvent();
+}
+
+void Window::set_gamepad_source(const std::shared_ptr<Gamepad::Source>& gamepadSource)
+{
+    access_registry(
+        [&](Registry&)
+        {
+            sGamepadSource = gamepadSource;
+        }
+    );
+}
+
+void Window::set_gamepad_responses(const Gamepad::Response& stickResponse, const Gamepad::Response& triggerResponse)
+{
+    access_registry(
+        [&](Registry&)
+        {
+            sGamepadStickResponse = stickResponse;
+            sGamepadTriggerResponse = triggerResponse;
+        }
+    );
+}
+
+void Window::destroy()
+{
+    mChildren.clear();
+    #ifdef DYNAMIC_STATIC_SYSTEM_OPENGL_ENABLED
+    if (!mFrameFences.empty()) {
+        // NOTE : make_context_current() throws if an EGL context can't be made
+        //  current, this method is called from the destructor so fences are
+        //  only deleted if the context can be made current without throwing.
+        bool current = mGlfwWindow != nullptr;
+        #ifdef DYNAMIC_STATIC_PLATFORM_LINUX
+        if (mEglContext) {
+            current = mEglContext->try_make_current();
+        } else
+        #endif // DYNAMIC_STATIC_PLATFORM_LINUX
+        if (mGlfwWindow) {
+            glfwMakeContextCurrent(mGlfwWindow);
+        }
+        for (auto frameFence : mFrameFences) {
+            if (current && frameFence) {
+                dst_gl(glDeleteSync(frameFence));
             }
         }
+        mFrameFences.clear();
+    }
+    #endif // DYNAMIC_STATIC_SYSTEM_OPENGL_ENABLED
+    access_registry(
+        [&](Registry& registry)
+        {
+            registry.erase(mHandle);
+            destroy_glfw_window(registry, mGlfwWindow);
+            #if defined(DYNAMIC_STATIC_SYSTEM_OPENGL_ENABLED) && defined(DYNAMIC_STATIC_PLATFORM_LINUX)
+            mEglContext.reset();
+            #endif
+        }
     );
+    mHandle = { };
+    mGlfwWindow = nullptr;
+}
+
+void Window::poll_gamepads()
+{
+    if (sGamepadSource) {
+        sGamepadSource->poll(&sGamepadState);
+    } else if (sGlfwReferenceCount) {
+        poll_glfw_gamepads(&sGamepadState);
+    } else {
+        sGamepadState.reset();
+    }
+    Gamepad::process(sGamepadStickResponse, sGamepadTriggerResponse, &sGamepadState);
+}
+
+void Window::process_glfw_event(const Input::Event& event)
+{
+    // NOTE : Live Resize events are applied even while replaying so that
+    //  Info::extent always matches the actual framebuffer, recorded Resize
+    //  events are only replayed as Input::Events.
+    if (event.type == Input::Event::Type::Resize) {
+        mInfo.extent = { (int)event.value.x, (int)event.value.y };
+        mResized = true;
+        #if defined(DYNAMIC_STATIC_SYSTEM_OPENGL_ENABLED) && defined(DYNAMIC_STATIC_PLATFORM_LINUX)
+        if (mEglContext && mEglContext->get_extent() != mInfo.extent) {
+            mEglContext->resize(mInfo.extent);
+        }
+        #endif
+    }
+    if (!mInputReplayer.is_open()) {
+        process_event(event);
+    }
+}
+
+void Window::process_event(const Input::Event& event)
+{
+    switch (event.type) {
+    case Input::Event::Type::Text: {
+        mTextStream.push(event.code);
+    } break;
+    default: {
+    } break;
+    }
+    mInput.stage(event);
+    mInputRecorder.write(event);
+}
+
+void Window::stage_gamepad_events(const Gamepad::State& state)
+{
+    // NOTE : Gamepad state is diffed against the state this Window last polled
+    //  rather than its Input so that Input::revert() and replay can't cause
+    //  changes to be missed or repeated.  Events are processed like GLFW events
+    //  so they're recorded and suppressed by replay.
+    const auto& polled = mPolledGamepadState;
+    Input::Event event { };
+    event.timestamp = dst::HighResolutionClock::now();
+    event.type = Input::Event::Type::GamepadConnection;
+    for (auto gamepad_i : polled.connected ^ state.connected) {
+        event.code = (uint32_t)gamepad_i;
+        event.action = state.connected[gamepad_i] ? Input::Event::Action::Press : Input::Event::Action::Release;
+        process_glfw_event(event);
+    }
+    event.type = Input::Event::Type::GamepadButton;
+    for (auto bit_i : polled.buttons ^ state.buttons) {
+        event.code = Input::Event::get_gamepad_code(bit_i % Gamepad::Capacity, (uint32_t)(bit_i / Gamepad::Capacity));
+        event.action = state.buttons[bit_i] ? Input::Event::Action::Press : Input::Event::Action::Release;
+        process_glfw_event(event);
+    }
+    event.type = Input::Event::Type::GamepadAxis;
+    event.action = { };
+    for (size_t axis_i = 0; axis_i < (size_t)Gamepad::Axis::Count; ++axis_i) {
+        for (size_t gamepad_i = 0; gamepad_i < Gamepad::Capacity; ++gamepad_i) {
+            auto value = state.axes[axis_i][gamepad_i];
+            if (value != polled.axes[axis_i][gamepad_i]) {
+                event.code = Input::Event::get_gamepad_code(gamepad_i, (uint32_t)axis_i);
+                event.value = { (double)value, 0 };
+                process_glfw_event(event);
+            }
+        }
+    }
+    mPolledGamepadState = state;
 }
 
 } // namespace sys